@@ -0,0 +1,88 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryColumns.h"
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<bool>& Column )
+{
+	return AddColumn( Key, EColumnType::Boolean, &Column );
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<float>& Column )
+{
+	return AddColumn( Key, EColumnType::Float, &Column );
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<double>& Column )
+{
+	return AddColumn( Key, EColumnType::Number, &Column );
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<int32>& Column )
+{
+	return AddColumn( Key, EColumnType::Integer, &Column );
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<int64>& Column )
+{
+	return AddColumn( Key, EColumnType::Integer64, &Column );
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<FString>& Column )
+{
+	return AddColumn( Key, EColumnType::String, &Column );
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<FName>& Column )
+{
+	return AddColumn( Key, EColumnType::Name, &Column );
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<FVector>& Column )
+{
+	return AddColumn( Key, EColumnType::Vector, &Column );
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::Add( const FString& Key, TArray<FJsonLibraryValue>& Column )
+{
+	return AddColumn( Key, EColumnType::Value, &Column );
+}
+
+int32 FJsonLibraryColumns::Num() const
+{
+	return Columns.Num();
+}
+
+int32 FJsonLibraryColumns::GetRowCount() const
+{
+	int32 RowCount = 0;
+	for ( const FColumn& Column : Columns )
+	{
+		int32 ColumnCount = 0;
+		switch ( Column.Type )
+		{
+			case EColumnType::Boolean:   ColumnCount = static_cast<TArray<bool>*>( Column.Array )->Num(); break;
+			case EColumnType::Float:     ColumnCount = static_cast<TArray<float>*>( Column.Array )->Num(); break;
+			case EColumnType::Number:    ColumnCount = static_cast<TArray<double>*>( Column.Array )->Num(); break;
+			case EColumnType::Integer:   ColumnCount = static_cast<TArray<int32>*>( Column.Array )->Num(); break;
+			case EColumnType::Integer64: ColumnCount = static_cast<TArray<int64>*>( Column.Array )->Num(); break;
+			case EColumnType::String:    ColumnCount = static_cast<TArray<FString>*>( Column.Array )->Num(); break;
+			case EColumnType::Name:      ColumnCount = static_cast<TArray<FName>*>( Column.Array )->Num(); break;
+			case EColumnType::Vector:    ColumnCount = static_cast<TArray<FVector>*>( Column.Array )->Num(); break;
+			case EColumnType::Value:     ColumnCount = static_cast<TArray<FJsonLibraryValue>*>( Column.Array )->Num(); break;
+		}
+
+		RowCount = FMath::Max( RowCount, ColumnCount );
+	}
+
+	return RowCount;
+}
+
+FJsonLibraryColumns& FJsonLibraryColumns::AddColumn( const FString& Key, EColumnType Type, void* Array )
+{
+	FColumn Column;
+	Column.Key   = Key;
+	Column.Type  = Type;
+	Column.Array = Array;
+
+	Columns.Add( Column );
+	return *this;
+}
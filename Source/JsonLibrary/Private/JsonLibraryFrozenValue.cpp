@@ -0,0 +1,295 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryFrozenValue.h"
+#include "JsonLibraryMerge.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+
+namespace
+{
+	const TArray<TSharedPtr<FJsonValue>>* GetFrozenArray( const FJsonValue* Value )
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Array;
+		if ( Value && Value->Type == EJson::Array && Value->TryGetArray( Array ) )
+			return Array;
+
+		return nullptr;
+	}
+
+	const FJsonObject* GetFrozenObject( const FJsonValue* Value )
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if ( Value && Value->Type == EJson::Object && Value->TryGetObject( Object ) && Object )
+			return Object->Get();
+
+		return nullptr;
+	}
+
+	// writes from raw pointers so that no reference counts are touched
+	template<class PrintPolicy>
+	void WriteFrozenValue( TJsonWriter<TCHAR, PrintPolicy>& Writer, const FString* Identifier, const FJsonValue* Value )
+	{
+		switch ( Value ? Value->Type : EJson::None )
+		{
+			case EJson::Boolean:
+				if ( Identifier )
+					Writer.WriteValue( *Identifier, Value->AsBool() );
+				else
+					Writer.WriteValue( Value->AsBool() );
+				break;
+
+			case EJson::Number:
+				if ( Identifier )
+					Writer.WriteValue( *Identifier, Value->AsNumber() );
+				else
+					Writer.WriteValue( Value->AsNumber() );
+				break;
+
+			case EJson::String:
+				if ( Identifier )
+					Writer.WriteValue( *Identifier, Value->AsString() );
+				else
+					Writer.WriteValue( Value->AsString() );
+				break;
+
+			case EJson::Array:
+			{
+				if ( Identifier )
+					Writer.WriteArrayStart( *Identifier );
+				else
+					Writer.WriteArrayStart();
+
+				if ( const TArray<TSharedPtr<FJsonValue>>* Array = GetFrozenArray( Value ) )
+					for ( const TSharedPtr<FJsonValue>& Item : *Array )
+						WriteFrozenValue( Writer, nullptr, Item.Get() );
+
+				Writer.WriteArrayEnd();
+				break;
+			}
+
+			case EJson::Object:
+			{
+				if ( Identifier )
+					Writer.WriteObjectStart( *Identifier );
+				else
+					Writer.WriteObjectStart();
+
+				if ( const FJsonObject* Object = GetFrozenObject( Value ) )
+					for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Object->Values )
+						WriteFrozenValue( Writer, &Temp.Key, Temp.Value.Get() );
+
+				Writer.WriteObjectEnd();
+				break;
+			}
+
+			default:
+				if ( Identifier )
+					Writer.WriteNull( *Identifier );
+				else
+					Writer.WriteNull();
+				break;
+		}
+	}
+}
+
+FJsonLibraryFrozenValue::FJsonLibraryFrozenValue()
+	: Value( nullptr )
+{
+}
+
+FJsonLibraryFrozenValue::FJsonLibraryFrozenValue( const TSharedPtr<const FDocument, ESPMode::ThreadSafe>& InDocument, const FJsonValue* InValue )
+	: Document( InDocument )
+	, Value( InValue )
+{
+	if ( !Document.IsValid() )
+		Value = nullptr;
+}
+
+EJsonLibraryType FJsonLibraryFrozenValue::GetType() const
+{
+	if ( !Value )
+		return EJsonLibraryType::Invalid;
+
+	switch ( Value->Type )
+	{
+		case EJson::Null:    return EJsonLibraryType::Null;
+		case EJson::Boolean: return EJsonLibraryType::Boolean;
+		case EJson::Number:  return EJsonLibraryType::Number;
+		case EJson::String:  return EJsonLibraryType::String;
+		case EJson::Object:  return EJsonLibraryType::Object;
+		case EJson::Array:   return EJsonLibraryType::Array;
+	}
+
+	return EJsonLibraryType::Invalid;
+}
+
+bool FJsonLibraryFrozenValue::GetBoolean() const
+{
+	if ( !Value )
+		return false;
+
+	switch ( Value->Type )
+	{
+		case EJson::Boolean: return Value->AsBool();
+		case EJson::Number:  return Value->AsNumber() != 0.0;
+		case EJson::String:  return Value->AsString().ToBool();
+	}
+
+	return false;
+}
+
+float FJsonLibraryFrozenValue::GetFloat() const
+{
+	return (float)GetNumber();
+}
+
+int32 FJsonLibraryFrozenValue::GetInteger() const
+{
+	return (int32)GetNumber();
+}
+
+double FJsonLibraryFrozenValue::GetNumber() const
+{
+	if ( !Value )
+		return 0.0;
+
+	switch ( Value->Type )
+	{
+		case EJson::Boolean: return Value->AsBool() ? 1.0 : 0.0;
+		case EJson::Number:  return Value->AsNumber();
+		case EJson::String:
+		{
+			const FString String = Value->AsString();
+			return String.IsNumeric() ? FCString::Atod( *String ) : 0.0;
+		}
+	}
+
+	return 0.0;
+}
+
+FString FJsonLibraryFrozenValue::GetString() const
+{
+	if ( !Value )
+		return FString();
+
+	switch ( Value->Type )
+	{
+		case EJson::Boolean: return Value->AsBool() ? TEXT( "true" ) : TEXT( "false" );
+		case EJson::Number:  return FString::SanitizeFloat( Value->AsNumber(), 0 );
+		case EJson::String:  return Value->AsString();
+	}
+
+	return FString();
+}
+
+int32 FJsonLibraryFrozenValue::Count() const
+{
+	if ( const TArray<TSharedPtr<FJsonValue>>* Array = GetFrozenArray( Value ) )
+		return Array->Num();
+	if ( const FJsonObject* Object = GetFrozenObject( Value ) )
+		return Object->Values.Num();
+
+	return 0;
+}
+
+bool FJsonLibraryFrozenValue::HasKey( const FString& Key ) const
+{
+	const FJsonObject* Object = GetFrozenObject( Value );
+	if ( !Object )
+		return false;
+
+	return Object->Values.Contains( Key );
+}
+
+TArray<FString> FJsonLibraryFrozenValue::GetKeys() const
+{
+	TArray<FString> Keys;
+
+	const FJsonObject* Object = GetFrozenObject( Value );
+	if ( Object )
+		Object->Values.GenerateKeyArray( Keys );
+
+	return Keys;
+}
+
+FJsonLibraryFrozenValue FJsonLibraryFrozenValue::GetValue( const FString& Key ) const
+{
+	const FJsonObject* Object = GetFrozenObject( Value );
+	if ( !Object )
+		return FJsonLibraryFrozenValue();
+
+	const TSharedPtr<FJsonValue>* Field = Object->Values.Find( Key );
+	if ( !Field )
+		return FJsonLibraryFrozenValue();
+
+	return FJsonLibraryFrozenValue( Document, Field->Get() );
+}
+
+FJsonLibraryFrozenValue FJsonLibraryFrozenValue::GetItem( int32 Index ) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Array = GetFrozenArray( Value );
+	if ( !Array || !Array->IsValidIndex( Index ) )
+		return FJsonLibraryFrozenValue();
+
+	return FJsonLibraryFrozenValue( Document, ( *Array )[ Index ].Get() );
+}
+
+bool FJsonLibraryFrozenValue::IsValid() const
+{
+	return GetType() != EJsonLibraryType::Invalid;
+}
+
+FJsonLibraryFrozenValue FJsonLibraryFrozenValue::Parse( const FString& Text )
+{
+	// the parsed tree is not referenced anywhere else, so it can be frozen without a copy
+	FJsonLibraryValue Parsed = FJsonLibraryValue::Parse( Text );
+	return Create( MoveTemp( Parsed.JsonValue ) );
+}
+
+FString FJsonLibraryFrozenValue::Stringify( bool bCondensed /*= true*/ ) const
+{
+	if ( !Value || Value->Type == EJson::None )
+		return FString();
+
+	if ( Value->Type != EJson::Object && Value->Type != EJson::Array )
+		return Thaw().Stringify( bCondensed );
+
+	FString Text;
+	if ( bCondensed )
+	{
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create( &Text );
+		WriteFrozenValue( *Writer, nullptr, Value );
+		Writer->Close();
+	}
+	else
+	{
+		TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create( &Text );
+		WriteFrozenValue( *Writer, nullptr, Value );
+		Writer->Close();
+	}
+
+	Text.TrimStartInline();
+	Text.TrimEndInline();
+
+	return Text;
+}
+
+FJsonLibraryValue FJsonLibraryFrozenValue::Thaw() const
+{
+	return FJsonLibraryValue( Copy( Value ) );
+}
+
+FJsonLibraryFrozenValue FJsonLibraryFrozenValue::Create( TSharedPtr<FJsonValue>&& Root )
+{
+	if ( !Root.IsValid() )
+		return FJsonLibraryFrozenValue();
+
+	FDocument* Document = new FDocument();
+	Document->Root = MoveTemp( Root );
+
+	return FJsonLibraryFrozenValue( TSharedPtr<const FDocument, ESPMode::ThreadSafe>( Document ), Document->Root.Get() );
+}
+
+TSharedPtr<FJsonValue> FJsonLibraryFrozenValue::Copy( const FJsonValue* Source )
+{
+	return FJsonLibraryMerge::Copy( Source );
+}
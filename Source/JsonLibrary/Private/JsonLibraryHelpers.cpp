@@ -9,6 +9,11 @@ FJsonLibraryValue UJsonLibraryHelpers::Parse( const FString& Text, bool bComment
 	return FJsonLibraryValue::Parse( Text );
 }
 
+FJsonLibraryValue UJsonLibraryHelpers::ParseLazy( const FString& Text )
+{
+	return FJsonLibraryValue::ParseLazy( Text );
+}
+
 FJsonLibraryObject UJsonLibraryHelpers::ParseObject( const FString& Text, const FJsonLibraryObjectNotify& Notify )
 {
 	return FJsonLibraryObject::Parse( Text, Notify );
@@ -674,6 +679,23 @@ FJsonLibraryObject& UJsonLibraryHelpers::JsonObject_Add( FJsonLibraryObject& Tar
 	return Target;
 }
 
+FJsonLibraryObject& UJsonLibraryHelpers::JsonObject_DeepMerge( FJsonLibraryObject& Target, const FJsonLibraryObject& Object, EJsonLibraryArrayMerge Arrays, const FString& ArrayKey )
+{
+	Target.DeepMerge( Object, Arrays, ArrayKey );
+	return Target;
+}
+
+FJsonLibraryObject& UJsonLibraryHelpers::JsonObject_MergePatch( FJsonLibraryObject& Target, const FJsonLibraryObject& Patch )
+{
+	Target.MergePatch( Patch );
+	return Target;
+}
+
+FJsonLibraryObject UJsonLibraryHelpers::JsonObject_CreateMergePatch( const FJsonLibraryObject& Target, const FJsonLibraryObject& Object )
+{
+	return Target.CreateMergePatch( Object );
+}
+
 FJsonLibraryObject& UJsonLibraryHelpers::JsonObject_AddBooleanMap( FJsonLibraryObject& Target, const TMap<FString, bool>& Map )
 {
 	Target.AddBooleanMap( Map );
@@ -1663,6 +1685,62 @@ int32 UJsonLibraryHelpers::JsonList_FindList( const FJsonLibraryList& Target, co
 	return Target.FindList( Value, Index );
 }
 
+FJsonLibraryList& UJsonLibraryHelpers::JsonList_SortByKey( FJsonLibraryList& Target, const TArray<FString>& Keys, bool bDescending /*= false*/ )
+{
+	Target.SortByKey( Keys, bDescending );
+	return Target;
+}
+
+FJsonLibraryList UJsonLibraryHelpers::JsonList_FilterByPredicate( const FJsonLibraryList& Target, const FString& Predicate )
+{
+	return Target.FilterByPredicate( Predicate );
+}
+
+FJsonLibraryObject UJsonLibraryHelpers::JsonList_GroupBy( const FJsonLibraryList& Target, const FString& Key )
+{
+	return Target.GroupBy( Key );
+}
+
+FJsonLibraryList UJsonLibraryHelpers::JsonList_Distinct( const FJsonLibraryList& Target )
+{
+	return Target.Distinct();
+}
+
+FJsonLibraryList UJsonLibraryHelpers::JsonList_Pluck( const FJsonLibraryList& Target, const FString& Key )
+{
+	return Target.Pluck( Key );
+}
+
+float UJsonLibraryHelpers::JsonList_Sum( const FJsonLibraryList& Target, const FString& Key )
+{
+	return (float)Target.Sum( Key );
+}
+
+float UJsonLibraryHelpers::JsonList_Min( const FJsonLibraryList& Target, const FString& Key )
+{
+	return (float)Target.Min( Key );
+}
+
+float UJsonLibraryHelpers::JsonList_Max( const FJsonLibraryList& Target, const FString& Key )
+{
+	return (float)Target.Max( Key );
+}
+
+float UJsonLibraryHelpers::JsonList_Average( const FJsonLibraryList& Target, const FString& Key )
+{
+	return (float)Target.Average( Key );
+}
+
+bool UJsonLibraryHelpers::JsonList_ToDataTable( const FJsonLibraryList& Target, UDataTable* DataTable, const FString& RowNameKey /*= TEXT( "Name" )*/ )
+{
+	return Target.ToDataTable( DataTable, RowNameKey );
+}
+
+FJsonLibraryList UJsonLibraryHelpers::ConvertDataTableToList( const UDataTable* DataTable, const FString& RowNameKey /*= TEXT( "Name" )*/ )
+{
+	return FJsonLibraryList::FromDataTable( DataTable, RowNameKey );
+}
+
 bool UJsonLibraryHelpers::JsonList_IsValid( const FJsonLibraryList& Target )
 {
 	return Target.IsValid();
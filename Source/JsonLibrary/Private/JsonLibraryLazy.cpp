@@ -0,0 +1,667 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryLazy.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace
+{
+	struct FJsonLibraryLazyDocument
+	{
+		// shared with the caller, not copied
+		FJsonLibraryLazyText Text;
+
+		// positions of every opening bracket, and the matching closing bracket
+		TArray<int32> Opens;
+		TArray<int32> Closes;
+
+		explicit FJsonLibraryLazyDocument( const FJsonLibraryLazyText& InText )
+			: Text( InText )
+		{
+		}
+
+		int32 FindClose( int32 Open ) const
+		{
+			const int32 Slot = Algo::BinarySearch( Opens, Open );
+			return Slot != INDEX_NONE ? Closes[ Slot ] : INDEX_NONE;
+		}
+	};
+
+	typedef TSharedPtr<const FJsonLibraryLazyDocument, ESPMode::ThreadSafe> FJsonLibraryLazyDocumentPtr;
+
+	// deeper documents are left to the regular parser
+	const int32 MaxDepth = 512;
+
+	// only taken the first time a value is accessed, or to copy the text of one that hasn't been
+	FCriticalSection& GetLazyLock( const void* Value )
+	{
+		static FCriticalSection Locks[ 32 ];
+		return Locks[ ( UPTRINT( Value ) >> 4 ) % 32 ];
+	}
+
+	void SkipWhitespace( const FString& Text, int32& Position );
+	TSharedPtr<FJsonValue> ParseValue( const FJsonLibraryLazyDocumentPtr& Document, int32& Position );
+
+	// The source range of an object or array, and whether it has been parsed yet.
+	struct FJsonLibraryLazyRange
+	{
+		FJsonLibraryLazyDocumentPtr Document;
+		int32 Start = 0;
+		int32 End   = 0;
+
+		std::atomic<bool> bPending { false };
+
+		void Initialize( const FJsonLibraryLazyDocumentPtr& InDocument, int32 InStart, int32 InEnd )
+		{
+			Document = InDocument;
+			Start    = InStart;
+			End      = InEnd;
+			bPending = true;
+		}
+
+		// Parse the range once, values can be accessed from several threads at the same time
+		template<typename ParseType>
+		void Materialize( const void* Owner, ParseType Parse )
+		{
+			if ( !bPending.load( std::memory_order_acquire ) )
+				return;
+
+			FScopeLock Lock( &GetLazyLock( Owner ) );
+			if ( !bPending.load( std::memory_order_relaxed ) )
+				return;
+
+			Parse( Document, Start, End );
+			Document.Reset();
+
+			bPending.store( false, std::memory_order_release );
+		}
+
+		// Get the text without the whitespace outside of strings, if the range hasn't been parsed
+		bool GetText( const void* Owner, FString& Text ) const
+		{
+			if ( !bPending.load( std::memory_order_acquire ) )
+				return false;
+
+			FScopeLock Lock( &GetLazyLock( Owner ) );
+			if ( !bPending.load( std::memory_order_relaxed ) )
+				return false;
+
+			const TCHAR* Data = **Document->Text;
+
+			Text.Reset( End - Start + 1 );
+			bool bString = false;
+			for ( int32 Index = Start; Index <= End; Index++ )
+			{
+				const TCHAR Char = Data[ Index ];
+				if ( bString )
+				{
+					Text.AppendChar( Char );
+					if ( Char == '\\' )
+						Text.AppendChar( Data[ ++Index ] );
+					else if ( Char == '"' )
+						bString = false;
+				}
+				else if ( !FChar::IsWhitespace( Char ) )
+				{
+					Text.AppendChar( Char );
+					bString = Char == '"';
+				}
+			}
+
+			return true;
+		}
+	};
+
+	void MaterializeObject( const FJsonLibraryLazyDocumentPtr& Source, int32 Start, int32 End, TSharedPtr<FJsonObject>& Value );
+	void MaterializeArray( const FJsonLibraryLazyDocumentPtr& Source, int32 Start, int32 End, TArray<TSharedPtr<FJsonValue>>& Value );
+
+	class FJsonValueLazyObject : public FJsonValueObject
+	{
+	public:
+
+		FJsonValueLazyObject( const FJsonLibraryLazyDocumentPtr& InDocument, int32 InStart, int32 InEnd )
+			: FJsonValueObject( TSharedPtr<FJsonObject>() )
+		{
+			Range.Initialize( InDocument, InStart, InEnd );
+		}
+
+		virtual bool TryGetObject( const TSharedPtr<FJsonObject>*& Object ) const override
+		{
+			const_cast<FJsonValueLazyObject*>( this )->Materialize();
+			return FJsonValueObject::TryGetObject( Object );
+		}
+
+#if UE_VERSION >= 500
+		virtual bool TryGetObject( TSharedPtr<FJsonObject>*& Object ) override
+		{
+			Materialize();
+			return FJsonValueObject::TryGetObject( Object );
+		}
+#endif
+
+		bool GetText( FString& Text ) const
+		{
+			return Range.GetText( this, Text );
+		}
+
+		static const TCHAR* GetTypeName()
+		{
+			return TEXT( "LazyObject" );
+		}
+
+	protected:
+
+		virtual FString GetType() const override
+		{
+			return GetTypeName();
+		}
+
+	private:
+
+		FJsonLibraryLazyRange Range;
+
+		void Materialize()
+		{
+			Range.Materialize( this, [ this ]( const FJsonLibraryLazyDocumentPtr& Source, int32 Start, int32 End )
+			{
+				MaterializeObject( Source, Start, End, Value );
+			} );
+		}
+	};
+
+	class FJsonValueLazyArray : public FJsonValueArray
+	{
+	public:
+
+		FJsonValueLazyArray( const FJsonLibraryLazyDocumentPtr& InDocument, int32 InStart, int32 InEnd )
+			: FJsonValueArray( TArray<TSharedPtr<FJsonValue>>() )
+		{
+			Range.Initialize( InDocument, InStart, InEnd );
+		}
+
+		virtual bool TryGetArray( const TArray<TSharedPtr<FJsonValue>>*& Array ) const override
+		{
+			const_cast<FJsonValueLazyArray*>( this )->Materialize();
+			return FJsonValueArray::TryGetArray( Array );
+		}
+
+#if UE_VERSION >= 500
+		virtual bool TryGetArray( TArray<TSharedPtr<FJsonValue>>*& Array ) override
+		{
+			Materialize();
+			return FJsonValueArray::TryGetArray( Array );
+		}
+#endif
+
+		bool GetText( FString& Text ) const
+		{
+			return Range.GetText( this, Text );
+		}
+
+		static const TCHAR* GetTypeName()
+		{
+			return TEXT( "LazyArray" );
+		}
+
+	protected:
+
+		virtual FString GetType() const override
+		{
+			return GetTypeName();
+		}
+
+	private:
+
+		FJsonLibraryLazyRange Range;
+
+		void Materialize()
+		{
+			Range.Materialize( this, [ this ]( const FJsonLibraryLazyDocumentPtr& Source, int32 Start, int32 End )
+			{
+				MaterializeArray( Source, Start, End, Value );
+			} );
+		}
+	};
+
+	// FJsonValue has no RTTI, lazy values are recognized by the type name they report
+	class FJsonValueTypeQuery : public FJsonValue
+	{
+	public:
+
+		static FString GetTypeName( const FJsonValue* Value )
+		{
+			// the type name is protected, but can be queried through a member pointer taken from a derived class
+			FString ( FJsonValue::*GetTypeFunction )() const = &FJsonValueTypeQuery::GetType;
+			return ( Value->*GetTypeFunction )();
+		}
+	};
+
+	template<typename ValueType>
+	const ValueType* CastLazy( const FJsonValue* Value )
+	{
+		if ( !FJsonValueTypeQuery::GetTypeName( Value ).Equals( ValueType::GetTypeName(), ESearchCase::CaseSensitive ) )
+			return nullptr;
+
+		return static_cast<const ValueType*>( Value );
+	}
+
+	void SkipWhitespace( const FString& Text, int32& Position )
+	{
+		const TCHAR* Data = *Text;
+		while ( Position < Text.Len() && FChar::IsWhitespace( Data[ Position ] ) )
+			Position++;
+	}
+
+	// Validate a string and move past it, without copying it.
+	bool SkipString( const TCHAR* Data, int32 Length, int32& Position )
+	{
+		if ( Position >= Length || Data[ Position ] != '"' )
+			return false;
+
+		Position++;
+		while ( Position < Length )
+		{
+			const TCHAR Char = Data[ Position++ ];
+			if ( Char == '"' )
+				return true;
+
+			if ( Char != '\\' )
+				continue;
+
+			if ( Position >= Length )
+				return false;
+
+			switch ( Data[ Position++ ] )
+			{
+				case '"':
+				case '\\':
+				case '/':
+				case 'b':
+				case 'f':
+				case 'n':
+				case 'r':
+				case 't':
+					break;
+
+				case 'u':
+				{
+					if ( Position + 4 > Length )
+						return false;
+
+					for ( int32 Index = 0; Index < 4; Index++ )
+						if ( !FChar::IsHexDigit( Data[ Position++ ] ) )
+							return false;
+
+					break;
+				}
+				default:
+					return false;
+			}
+		}
+
+		return false;
+	}
+
+	bool ParseString( const FString& Text, int32& Position, FString& String )
+	{
+		const TCHAR* Data   = *Text;
+		const int32  Length = Text.Len();
+		if ( Position >= Length || Data[ Position ] != '"' )
+			return false;
+
+		// copy up to the first escape in one go
+		const int32 Start = ++Position;
+		while ( Position < Length && Data[ Position ] != '"' && Data[ Position ] != '\\' )
+			Position++;
+
+		String = Text.Mid( Start, Position - Start );
+		while ( Position < Length )
+		{
+			const TCHAR Char = Data[ Position++ ];
+			if ( Char == '"' )
+				return true;
+
+			if ( Char != '\\' )
+			{
+				String.AppendChar( Char );
+				continue;
+			}
+
+			if ( Position >= Length )
+				return false;
+
+			switch ( Data[ Position++ ] )
+			{
+				case '"':  String.AppendChar( '"' );  break;
+				case '\\': String.AppendChar( '\\' ); break;
+				case '/':  String.AppendChar( '/' );  break;
+				case 'b':  String.AppendChar( '\b' ); break;
+				case 'f':  String.AppendChar( '\f' ); break;
+				case 'n':  String.AppendChar( '\n' ); break;
+				case 'r':  String.AppendChar( '\r' ); break;
+				case 't':  String.AppendChar( '\t' ); break;
+				case 'u':
+				{
+					if ( Position + 4 > Length )
+						return false;
+
+					uint32 Code = 0;
+					for ( int32 Index = 0; Index < 4; Index++ )
+					{
+						const TCHAR Digit = Data[ Position++ ];
+						if ( !FChar::IsHexDigit( Digit ) )
+							return false;
+
+						Code = ( Code << 4 ) | FParse::HexDigit( Digit );
+					}
+
+					String.AppendChar( (TCHAR)Code );
+					break;
+				}
+				default:
+					return false;
+			}
+		}
+
+		return false;
+	}
+
+	TSharedPtr<FJsonValue> ParseValue( const FJsonLibraryLazyDocumentPtr& Document, int32& Position )
+	{
+		const FString& Text = *Document->Text;
+		SkipWhitespace( Text, Position );
+		if ( Position >= Text.Len() )
+			return TSharedPtr<FJsonValue>();
+
+		const TCHAR* Data = *Text;
+		switch ( Data[ Position ] )
+		{
+			case '{':
+			case '[':
+			{
+				// skip the contents, they are parsed when accessed
+				const int32 Start = Position;
+				const int32 End   = Document->FindClose( Start );
+				if ( End == INDEX_NONE )
+					return TSharedPtr<FJsonValue>();
+
+				Position = End + 1;
+				if ( Data[ Start ] == '{' )
+					return MakeShareable( new FJsonValueLazyObject( Document, Start, End ) );
+
+				return MakeShareable( new FJsonValueLazyArray( Document, Start, End ) );
+			}
+
+			case '"':
+			{
+				FString String;
+				if ( !ParseString( Text, Position, String ) )
+					return TSharedPtr<FJsonValue>();
+
+				return MakeShareable( new FJsonValueString( String ) );
+			}
+
+			case 't':
+				if ( FCString::Strncmp( Data + Position, TEXT( "true" ), 4 ) != 0 )
+					return TSharedPtr<FJsonValue>();
+
+				Position += 4;
+				return MakeShareable( new FJsonValueBoolean( true ) );
+
+			case 'f':
+				if ( FCString::Strncmp( Data + Position, TEXT( "false" ), 5 ) != 0 )
+					return TSharedPtr<FJsonValue>();
+
+				Position += 5;
+				return MakeShareable( new FJsonValueBoolean( false ) );
+
+			case 'n':
+				if ( FCString::Strncmp( Data + Position, TEXT( "null" ), 4 ) != 0 )
+					return TSharedPtr<FJsonValue>();
+
+				Position += 4;
+				return MakeShareable( new FJsonValueNull() );
+		}
+
+		const int32 Start = Position;
+		while ( Position < Text.Len() )
+		{
+			const TCHAR Char = Data[ Position ];
+			if ( !FChar::IsDigit( Char ) && Char != '-' && Char != '+' && Char != '.' && Char != 'e' && Char != 'E' )
+				break;
+
+			Position++;
+		}
+
+		if ( Position == Start )
+			return TSharedPtr<FJsonValue>();
+
+		return MakeShareable( new FJsonValueNumber( FCString::Atod( Data + Start ) ) );
+	}
+
+	void MaterializeObject( const FJsonLibraryLazyDocumentPtr& Source, int32 Start, int32 End, TSharedPtr<FJsonObject>& Value )
+	{
+		// the document was validated when it was indexed
+		Value = MakeShareable( new FJsonObject() );
+
+		const FString& Text = *Source->Text;
+		int32 Position = Start + 1;
+
+		SkipWhitespace( Text, Position );
+		while ( Position < End )
+		{
+			FString Key;
+			ParseString( Text, Position, Key );
+
+			SkipWhitespace( Text, Position );
+			Position++;
+
+			Value->Values.Add( Key, ParseValue( Source, Position ) );
+
+			SkipWhitespace( Text, Position );
+			if ( Position < End )
+			{
+				Position++;
+				SkipWhitespace( Text, Position );
+			}
+		}
+	}
+
+	void MaterializeArray( const FJsonLibraryLazyDocumentPtr& Source, int32 Start, int32 End, TArray<TSharedPtr<FJsonValue>>& Value )
+	{
+		// the document was validated when it was indexed
+		Value.Reset();
+
+		const FString& Text = *Source->Text;
+		int32 Position = Start + 1;
+
+		SkipWhitespace( Text, Position );
+		while ( Position < End )
+		{
+			Value.Add( ParseValue( Source, Position ) );
+
+			SkipWhitespace( Text, Position );
+			if ( Position < End )
+			{
+				Position++;
+				SkipWhitespace( Text, Position );
+			}
+		}
+	}
+
+	bool IndexDigits( const TCHAR* Data, int32 Length, int32& Position )
+	{
+		const int32 Start = Position;
+		while ( Position < Length && FChar::IsDigit( Data[ Position ] ) )
+			Position++;
+
+		return Position > Start;
+	}
+
+	bool IndexNumber( const TCHAR* Data, int32 Length, int32& Position )
+	{
+		if ( Position < Length && Data[ Position ] == '-' )
+			Position++;
+
+		if ( Position < Length && Data[ Position ] == '0' )
+			Position++;
+		else if ( !IndexDigits( Data, Length, Position ) )
+			return false;
+
+		if ( Position < Length && Data[ Position ] == '.' )
+		{
+			Position++;
+			if ( !IndexDigits( Data, Length, Position ) )
+				return false;
+		}
+
+		if ( Position < Length && ( Data[ Position ] == 'e' || Data[ Position ] == 'E' ) )
+		{
+			Position++;
+			if ( Position < Length && ( Data[ Position ] == '+' || Data[ Position ] == '-' ) )
+				Position++;
+
+			if ( !IndexDigits( Data, Length, Position ) )
+				return false;
+		}
+
+		return true;
+	}
+
+	// Validate a value and record where its objects and arrays open and close, in the order they open.
+	bool IndexValue( FJsonLibraryLazyDocument& Document, int32& Position, int32 Depth )
+	{
+		const FString& Text   = *Document.Text;
+		const TCHAR*   Data   = *Text;
+		const int32    Length = Text.Len();
+
+		SkipWhitespace( Text, Position );
+		if ( Position >= Length )
+			return false;
+
+		switch ( Data[ Position ] )
+		{
+			case '"':
+				return SkipString( Data, Length, Position );
+
+			case 't':
+				if ( FCString::Strncmp( Data + Position, TEXT( "true" ), 4 ) != 0 )
+					return false;
+
+				Position += 4;
+				return true;
+
+			case 'f':
+				if ( FCString::Strncmp( Data + Position, TEXT( "false" ), 5 ) != 0 )
+					return false;
+
+				Position += 5;
+				return true;
+
+			case 'n':
+				if ( FCString::Strncmp( Data + Position, TEXT( "null" ), 4 ) != 0 )
+					return false;
+
+				Position += 4;
+				return true;
+
+			case '{':
+			case '[':
+				break;
+
+			default:
+				return IndexNumber( Data, Length, Position );
+		}
+
+		if ( Depth >= MaxDepth )
+			return false;
+
+		const TCHAR Close = Data[ Position ] == '{' ? '}' : ']';
+		const int32 Slot  = Document.Opens.Add( Position );
+		Document.Closes.Add( INDEX_NONE );
+
+		Position++;
+		SkipWhitespace( Text, Position );
+
+		if ( Position < Length && Data[ Position ] != Close )
+		{
+			while ( true )
+			{
+				if ( Close == '}' )
+				{
+					SkipWhitespace( Text, Position );
+					if ( !SkipString( Data, Length, Position ) )
+						return false;
+
+					SkipWhitespace( Text, Position );
+					if ( Position >= Length || Data[ Position ] != ':' )
+						return false;
+
+					Position++;
+				}
+
+				if ( !IndexValue( Document, Position, Depth + 1 ) )
+					return false;
+
+				SkipWhitespace( Text, Position );
+				if ( Position >= Length || Data[ Position ] != ',' )
+					break;
+
+				Position++;
+			}
+		}
+
+		if ( Position >= Length || Data[ Position ] != Close )
+			return false;
+
+		Document.Closes[ Slot ] = Position++;
+		return true;
+	}
+}
+
+TSharedPtr<FJsonValue> FJsonLibraryLazy::Parse( const FJsonLibraryLazyText& Text )
+{
+	FJsonLibraryLazyDocument* Document = new FJsonLibraryLazyDocument( Text );
+	FJsonLibraryLazyDocumentPtr DocumentPtr( Document );
+
+	const FString& Source = *Text;
+
+	int32 Position = 0;
+	SkipWhitespace( Source, Position );
+	if ( Position >= Source.Len() || ( Source[ Position ] != '{' && Source[ Position ] != '[' ) )
+		return TSharedPtr<FJsonValue>();
+
+	// validate everything up front, so values read the same before and after they are accessed
+	const int32 Root = Position;
+	if ( !IndexValue( *Document, Position, 0 ) )
+		return TSharedPtr<FJsonValue>();
+
+	SkipWhitespace( Source, Position );
+	if ( Position != Source.Len() )
+		return TSharedPtr<FJsonValue>();
+
+	Position = Root;
+	return ParseValue( DocumentPtr, Position );
+}
+
+bool FJsonLibraryLazy::TryGetText( const FJsonValue* Value, FString& Text, bool bCondensed )
+{
+	// pretty text is left to the writer, which parses the value first
+	if ( !Value || !bCondensed )
+		return false;
+
+	if ( Value->Type == EJson::Object )
+	{
+		const FJsonValueLazyObject* Object = CastLazy<FJsonValueLazyObject>( Value );
+		return Object && Object->GetText( Text );
+	}
+
+	if ( Value->Type == EJson::Array )
+	{
+		const FJsonValueLazyArray* Array = CastLazy<FJsonValueLazyArray>( Value );
+		return Array && Array->GetText( Text );
+	}
+
+	return false;
+}
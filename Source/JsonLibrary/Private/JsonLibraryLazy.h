@@ -0,0 +1,22 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+
+// Lazy parser for large JSON documents.
+// The whole document is validated and its brackets indexed up front, objects and arrays are parsed when they are first accessed.
+// Values can be accessed from several threads, the first access of each one takes a short lock.
+typedef TSharedRef<const FString, ESPMode::ThreadSafe> FJsonLibraryLazyText;
+
+class FJsonLibraryLazy
+{
+public:
+
+	// Parse an object or array string, or return null if it is not valid or nested too deep.
+	// The text is shared with the values until they are accessed, it is never copied.
+	static TSharedPtr<FJsonValue> Parse( const FJsonLibraryLazyText& Text );
+
+	// Get the condensed text of an object or array that has not been accessed yet.
+	// Numbers and escapes are kept as they were written in the original text.
+	static bool TryGetText( const FJsonValue* Value, FString& Text, bool bCondensed );
+};
@@ -1,7 +1,14 @@
 // Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
 #include "JsonLibraryList.h"
 #include "JsonLibraryObject.h"
+#include "JsonLibraryColumns.h"
+#include "JsonLibraryConverter.h"
+#include "JsonLibraryFrozenValue.h"
 #include "JsonLibraryHelpers.h"
+#include "JsonLibraryLazy.h"
+#include "JsonLibraryQuery.h"
+#include "Engine/DataTable.h"
+#include "Async/ParallelFor.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Policies/PrettyJsonPrintPolicy.h"
 
@@ -1247,6 +1254,213 @@ int32 FJsonLibraryList::FindList( const FJsonLibraryList& Value, int32 Index ) c
 	return FindValue( FJsonLibraryValue( Value ), Index );
 }
 
+void FJsonLibraryList::SortByKey( const TArray<FString>& Keys, bool bDescending /*= false*/ )
+{
+	TArray<TSharedPtr<FJsonValue>>* Json = SetJsonArray();
+	if ( !Json || Json->Num() < 2 )
+		return;
+
+	const int32 ItemCount = Json->Num();
+	const int32 KeyCount = FMath::Max( Keys.Num(), 1 );
+
+	// resolve the sort keys once per item
+	TArray<const FJsonValue*> SortValues;
+	SortValues.SetNumUninitialized( ItemCount * KeyCount );
+	for ( int32 i = 0; i < ItemCount; i++ )
+	{
+		const FJsonValue* Item = ( *Json )[ i ].Get();
+		if ( Keys.Num() > 0 )
+		{
+			for ( int32 k = 0; k < KeyCount; k++ )
+				SortValues[ i * KeyCount + k ] = FJsonLibraryQuery::FindField( Item, Keys[ k ] );
+		}
+		else
+			SortValues[ i ] = Item;
+	}
+
+	TArray<int32> Indices;
+	Indices.SetNumUninitialized( ItemCount );
+	for ( int32 i = 0; i < ItemCount; i++ )
+		Indices[ i ] = i;
+
+	Indices.StableSort( [ &SortValues, KeyCount, bDescending ]( int32 A, int32 B )
+	{
+		for ( int32 k = 0; k < KeyCount; k++ )
+		{
+			const int32 Result = FJsonLibraryQuery::Compare( SortValues[ A * KeyCount + k ], SortValues[ B * KeyCount + k ] );
+			if ( Result != 0 )
+				return bDescending ? Result > 0 : Result < 0;
+		}
+
+		return false;
+	} );
+
+	TArray<TSharedPtr<FJsonValue>> Sorted;
+	Sorted.Reserve( ItemCount );
+	for ( int32 i = 0; i < ItemCount; i++ )
+		Sorted.Add( ( *Json )[ Indices[ i ] ] );
+
+	if ( OnNotify.IsBound() )
+	{
+		for ( int32 i = 0; i < ItemCount; i++ )
+		{
+			if ( ( *Json )[ i ] == Sorted[ i ] )
+				continue;
+
+			NotifyCheck( i );
+			( *Json )[ i ] = Sorted[ i ];
+			NotifyChange( i, FJsonLibraryValue( Sorted[ i ] ) );
+		}
+	}
+	else
+		*Json = MoveTemp( Sorted );
+}
+
+FJsonLibraryList FJsonLibraryList::FilterByPredicate( const FString& Predicate ) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json )
+		return FJsonLibraryList( TSharedPtr<FJsonValueArray>() );
+
+	TSharedPtr<FJsonLibraryPredicate> CompiledPredicate = FJsonLibraryPredicate::Compile( Predicate );
+	if ( !CompiledPredicate.IsValid() )
+		return FJsonLibraryList( TSharedPtr<FJsonValueArray>() );
+
+	const int32 ItemCount = Json->Num();
+
+	TArray<bool> Matches;
+	Matches.SetNumZeroed( ItemCount );
+
+	const FJsonLibraryPredicate& Filter = *CompiledPredicate;
+	ParallelFor( ItemCount, [ Json, &Filter, &Matches ]( int32 Index )
+	{
+		Matches[ Index ] = Filter.Evaluate( ( *Json )[ Index ].Get() );
+	}, ItemCount < FJsonLibraryQuery::ParallelThreshold );
+
+	FJsonLibraryList List;
+	TArray<TSharedPtr<FJsonValue>>* ListJson = List.SetJsonArray();
+	for ( int32 i = 0; i < ItemCount; i++ )
+		if ( Matches[ i ] )
+			ListJson->Add( ( *Json )[ i ] );
+
+	return List;
+}
+
+FJsonLibraryObject FJsonLibraryList::GroupBy( const FString& Key ) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json )
+		return FJsonLibraryObject( TSharedPtr<FJsonValueObject>() );
+
+	TArray<FString> Path;
+	FJsonLibraryQuery::ParsePath( Key, Path );
+
+	// keep the type in the key so that 1 and "1" are separate groups
+	TMap<FString, TArray<TSharedPtr<FJsonValue>>> Groups;
+	for ( int32 i = 0; i < Json->Num(); i++ )
+	{
+		const TSharedPtr<FJsonValue>& Item = ( *Json )[ i ];
+		Groups.FindOrAdd( FJsonLibraryQuery::GetKey( FJsonLibraryQuery::FindPath( Item, Path ), true ) ).Add( Item );
+	}
+
+	FJsonLibraryObject Object;
+	TSharedPtr<FJsonObject> ObjectJson = Object.SetJsonObject();
+	for ( TPair<FString, TArray<TSharedPtr<FJsonValue>>>& Group : Groups )
+		ObjectJson->SetField( Group.Key, MakeShareable( new FJsonValueArray( Group.Value ) ) );
+
+	return Object;
+}
+
+FJsonLibraryList FJsonLibraryList::Distinct() const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json )
+		return FJsonLibraryList( TSharedPtr<FJsonValueArray>() );
+
+	TSet<FString> Keys;
+	Keys.Reserve( Json->Num() );
+
+	FJsonLibraryList List;
+	TArray<TSharedPtr<FJsonValue>>* ListJson = List.SetJsonArray();
+	for ( int32 i = 0; i < Json->Num(); i++ )
+	{
+		bool bAlreadyInSet = false;
+		Keys.Add( FJsonLibraryQuery::GetKey( ( *Json )[ i ], true ), &bAlreadyInSet );
+
+		if ( !bAlreadyInSet )
+			ListJson->Add( ( *Json )[ i ] );
+	}
+
+	return List;
+}
+
+FJsonLibraryList FJsonLibraryList::Pluck( const FString& Key ) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json )
+		return FJsonLibraryList( TSharedPtr<FJsonValueArray>() );
+
+	FJsonLibraryList List;
+	TArray<TSharedPtr<FJsonValue>>* ListJson = List.SetJsonArray();
+	ListJson->Reserve( Json->Num() );
+
+	TArray<FString> Path;
+	FJsonLibraryQuery::ParsePath( Key, Path );
+
+	for ( int32 i = 0; i < Json->Num(); i++ )
+	{
+		TSharedPtr<FJsonValue> Value = FJsonLibraryQuery::FindPath( ( *Json )[ i ], Path );
+
+		// keep the items aligned with this list
+		if ( !Value.IsValid() )
+			Value = MakeShareable( new FJsonValueNull() );
+
+		ListJson->Add( Value );
+	}
+
+	return List;
+}
+
+double FJsonLibraryList::Sum( const FString& Key /*= FString()*/ ) const
+{
+	double ItemSum, ItemMin, ItemMax;
+	int32 ItemCount;
+	if ( !Aggregate( Key, ItemSum, ItemMin, ItemMax, ItemCount ) )
+		return 0.0;
+
+	return ItemSum;
+}
+
+double FJsonLibraryList::Min( const FString& Key /*= FString()*/ ) const
+{
+	double ItemSum, ItemMin, ItemMax;
+	int32 ItemCount;
+	if ( !Aggregate( Key, ItemSum, ItemMin, ItemMax, ItemCount ) )
+		return 0.0;
+
+	return ItemMin;
+}
+
+double FJsonLibraryList::Max( const FString& Key /*= FString()*/ ) const
+{
+	double ItemSum, ItemMin, ItemMax;
+	int32 ItemCount;
+	if ( !Aggregate( Key, ItemSum, ItemMin, ItemMax, ItemCount ) )
+		return 0.0;
+
+	return ItemMax;
+}
+
+double FJsonLibraryList::Average( const FString& Key /*= FString()*/ ) const
+{
+	double ItemSum, ItemMin, ItemMax;
+	int32 ItemCount;
+	if ( !Aggregate( Key, ItemSum, ItemMin, ItemMax, ItemCount ) )
+		return 0.0;
+
+	return ItemSum / ItemCount;
+}
+
 const TArray<TSharedPtr<FJsonValue>>* FJsonLibraryList::GetJsonArray() const
 {
 	if ( JsonArray.IsValid() && JsonArray->Type == EJson::Array )
@@ -1292,6 +1506,10 @@ bool FJsonLibraryList::TryParse( const FString& Text, bool bStripComments /*= fa
 
 bool FJsonLibraryList::TryStringify( FString& Text, bool bCondensed /*= true*/ ) const
 {
+	// untouched lazy lists keep their original text
+	if ( FJsonLibraryLazy::TryGetText( JsonArray.Get(), Text, bCondensed ) )
+		return true;
+
 	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
 	if ( !Json )
 		return false;
@@ -1430,6 +1648,70 @@ void FJsonLibraryList::NotifyRemove( int32 Index )
 	NotifyValue.Reset();
 }
 
+bool FJsonLibraryList::Aggregate( const FString& Key, double& OutSum, double& OutMin, double& OutMax, int32& OutCount ) const
+{
+	OutSum   = 0.0;
+	OutMin   = 0.0;
+	OutMax   = 0.0;
+	OutCount = 0;
+
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json || Json->Num() <= 0 )
+		return false;
+
+	struct FChunk
+	{
+		double Sum   = 0.0;
+		double Min   = TNumericLimits<double>::Max();
+		double Max   = TNumericLimits<double>::Lowest();
+		int32  Count = 0;
+	};
+
+	// split large lists into chunks that are reduced on worker threads
+	const int32 ItemCount = Json->Num();
+	const int32 ChunkSize = FJsonLibraryQuery::ParallelThreshold;
+	const int32 ChunkCount = FMath::DivideAndRoundUp( ItemCount, ChunkSize );
+
+	TArray<FChunk> Chunks;
+	Chunks.SetNum( ChunkCount );
+
+	ParallelFor( ChunkCount, [ Json, &Key, &Chunks, ItemCount, ChunkSize ]( int32 ChunkIndex )
+	{
+		FChunk& Chunk = Chunks[ ChunkIndex ];
+
+		const int32 End = FMath::Min( ItemCount, ( ChunkIndex + 1 ) * ChunkSize );
+		for ( int32 i = ChunkIndex * ChunkSize; i < End; i++ )
+		{
+			double Number;
+			if ( !FJsonLibraryQuery::TryGetNumber( FJsonLibraryQuery::FindField( ( *Json )[ i ].Get(), Key ), Number ) )
+				continue;
+
+			Chunk.Sum += Number;
+			Chunk.Min  = FMath::Min( Chunk.Min, Number );
+			Chunk.Max  = FMath::Max( Chunk.Max, Number );
+			Chunk.Count++;
+		}
+	}, ChunkCount <= 1 );
+
+	FChunk Total;
+	for ( const FChunk& Chunk : Chunks )
+	{
+		Total.Sum   += Chunk.Sum;
+		Total.Min    = FMath::Min( Total.Min, Chunk.Min );
+		Total.Max    = FMath::Max( Total.Max, Chunk.Max );
+		Total.Count += Chunk.Count;
+	}
+
+	if ( Total.Count <= 0 )
+		return false;
+
+	OutSum   = Total.Sum;
+	OutMin   = Total.Min;
+	OutMax   = Total.Max;
+	OutCount = Total.Count;
+	return true;
+}
+
 bool FJsonLibraryList::IsValid() const
 {
 	if ( GetJsonArray() )
@@ -1482,6 +1764,11 @@ FString FJsonLibraryList::Stringify( bool bCondensed /*= true*/ ) const
 	return FString();
 }
 
+FJsonLibraryFrozenValue FJsonLibraryList::Freeze() const
+{
+	return FJsonLibraryValue( *this ).Freeze();
+}
+
 TArray<FJsonLibraryValue> FJsonLibraryList::ToArray() const
 {
 	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
@@ -1678,6 +1965,219 @@ TArray<FJsonLibraryObject> FJsonLibraryList::ToObjectArray() const
 	return Array;
 }
 
+bool FJsonLibraryList::ToColumns( const FJsonLibraryColumns& Columns ) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json )
+		return false;
+
+	typedef FJsonLibraryColumns::EColumnType EColumnType;
+
+	const int32 RowCount = Json->Num();
+	for ( const FJsonLibraryColumns::FColumn& Column : Columns.Columns )
+	{
+		switch ( Column.Type )
+		{
+			case EColumnType::Boolean:   static_cast<TArray<bool>*>( Column.Array )->Reset( RowCount ); break;
+			case EColumnType::Float:     static_cast<TArray<float>*>( Column.Array )->Reset( RowCount ); break;
+			case EColumnType::Number:    static_cast<TArray<double>*>( Column.Array )->Reset( RowCount ); break;
+			case EColumnType::Integer:   static_cast<TArray<int32>*>( Column.Array )->Reset( RowCount ); break;
+			case EColumnType::Integer64: static_cast<TArray<int64>*>( Column.Array )->Reset( RowCount ); break;
+			case EColumnType::String:    static_cast<TArray<FString>*>( Column.Array )->Reset( RowCount ); break;
+			case EColumnType::Name:      static_cast<TArray<FName>*>( Column.Array )->Reset( RowCount ); break;
+			case EColumnType::Vector:    static_cast<TArray<FVector>*>( Column.Array )->Reset( RowCount ); break;
+			case EColumnType::Value:     static_cast<TArray<FJsonLibraryValue>*>( Column.Array )->Reset( RowCount ); break;
+		}
+	}
+
+	// walk each row once and append one item to every column
+	for ( int32 i = 0; i < RowCount; i++ )
+	{
+		const TSharedPtr<FJsonValue>& Item = ( *Json )[ i ];
+
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		if ( !Item.IsValid() || Item->Type != EJson::Object || !Item->TryGetObject( Object ) || !Object || !Object->IsValid() )
+			Object = nullptr;
+
+		for ( const FJsonLibraryColumns::FColumn& Column : Columns.Columns )
+		{
+			const TSharedPtr<FJsonValue>* Field = Object ? ( *Object )->Values.Find( Column.Key ) : nullptr;
+			const FJsonLibraryValue Value( Field ? *Field : TSharedPtr<FJsonValue>() );
+
+			const bool bNumber = Field && Field->IsValid() && ( *Field )->Type == EJson::Number;
+			switch ( Column.Type )
+			{
+				case EColumnType::Boolean:   static_cast<TArray<bool>*>( Column.Array )->Add( Value.GetBoolean() ); break;
+				case EColumnType::Float:     static_cast<TArray<float>*>( Column.Array )->Add( bNumber ? (float)( *Field )->AsNumber() : Value.GetFloat() ); break;
+				case EColumnType::Number:    static_cast<TArray<double>*>( Column.Array )->Add( bNumber ? ( *Field )->AsNumber() : Value.GetNumber() ); break;
+				case EColumnType::Integer:   static_cast<TArray<int32>*>( Column.Array )->Add( bNumber ? (int32)( *Field )->AsNumber() : Value.GetInteger() ); break;
+				case EColumnType::Integer64: static_cast<TArray<int64>*>( Column.Array )->Add( Value.GetInt64() ); break;
+				case EColumnType::String:    static_cast<TArray<FString>*>( Column.Array )->Add( Value.GetString() ); break;
+				case EColumnType::Name:      static_cast<TArray<FName>*>( Column.Array )->Add( FName( *Value.GetString() ) ); break;
+				case EColumnType::Vector:    static_cast<TArray<FVector>*>( Column.Array )->Add( Value.GetVector() ); break;
+				case EColumnType::Value:     static_cast<TArray<FJsonLibraryValue>*>( Column.Array )->Add( Value ); break;
+			}
+		}
+	}
+
+	return true;
+}
+
+FJsonLibraryList FJsonLibraryList::FromColumns( const FJsonLibraryColumns& Columns )
+{
+	typedef FJsonLibraryColumns::EColumnType EColumnType;
+
+	FJsonLibraryList List;
+	TArray<TSharedPtr<FJsonValue>>* Json = List.SetJsonArray();
+
+	const int32 RowCount = Columns.GetRowCount();
+	Json->Reserve( RowCount );
+
+	for ( int32 i = 0; i < RowCount; i++ )
+	{
+		TSharedPtr<FJsonObject> Object = MakeShareable( new FJsonObject() );
+		Object->Values.Reserve( Columns.Num() );
+
+		for ( const FJsonLibraryColumns::FColumn& Column : Columns.Columns )
+		{
+			TSharedPtr<FJsonValue> Value;
+			switch ( Column.Type )
+			{
+				case EColumnType::Boolean:
+				{
+					const TArray<bool>& Array = *static_cast<const TArray<bool>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = MakeShareable( new FJsonValueBoolean( Array[ i ] ) );
+					break;
+				}
+				case EColumnType::Float:
+				{
+					const TArray<float>& Array = *static_cast<const TArray<float>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = MakeShareable( new FJsonValueNumber( Array[ i ] ) );
+					break;
+				}
+				case EColumnType::Number:
+				{
+					const TArray<double>& Array = *static_cast<const TArray<double>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = MakeShareable( new FJsonValueNumber( Array[ i ] ) );
+					break;
+				}
+				case EColumnType::Integer:
+				{
+					const TArray<int32>& Array = *static_cast<const TArray<int32>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = MakeShareable( new FJsonValueNumber( Array[ i ] ) );
+					break;
+				}
+				case EColumnType::Integer64:
+				{
+					const TArray<int64>& Array = *static_cast<const TArray<int64>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = FJsonLibraryValue( Array[ i ] ).JsonValue;
+					break;
+				}
+				case EColumnType::String:
+				{
+					const TArray<FString>& Array = *static_cast<const TArray<FString>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = MakeShareable( new FJsonValueString( Array[ i ] ) );
+					break;
+				}
+				case EColumnType::Name:
+				{
+					const TArray<FName>& Array = *static_cast<const TArray<FName>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = MakeShareable( new FJsonValueString( Array[ i ].ToString() ) );
+					break;
+				}
+				case EColumnType::Vector:
+				{
+					const TArray<FVector>& Array = *static_cast<const TArray<FVector>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = FJsonLibraryObject( Array[ i ] ).JsonObject;
+					break;
+				}
+				case EColumnType::Value:
+				{
+					const TArray<FJsonLibraryValue>& Array = *static_cast<const TArray<FJsonLibraryValue>*>( Column.Array );
+					if ( Array.IsValidIndex( i ) )
+						Value = Array[ i ].JsonValue;
+					break;
+				}
+			}
+
+			if ( Value.IsValid() )
+				Object->Values.Add( Column.Key, Value );
+		}
+
+		Json->Add( MakeShareable( new FJsonValueObject( Object ) ) );
+	}
+
+	return List;
+}
+
+bool FJsonLibraryList::ToDataTable( UDataTable* DataTable, const FString& RowNameKey /*= TEXT( "Name" )*/ ) const
+{
+	const TArray<TSharedPtr<FJsonValue>>* Json = GetJsonArray();
+	if ( !Json || !DataTable || !DataTable->GetRowStruct() )
+		return false;
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	DataTable->EmptyTable();
+
+	// reuse one row buffer for the whole table
+	FStructOnScope RowData( RowStruct );
+	for ( int32 i = 0; i < Json->Num(); i++ )
+	{
+		const TSharedPtr<FJsonValue>& Item = ( *Json )[ i ];
+
+		const TSharedPtr<FJsonObject>* Object;
+		if ( !Item.IsValid() || Item->Type != EJson::Object || !Item->TryGetObject( Object ) || !Object || !Object->IsValid() )
+			continue;
+
+		FString RowName;
+		if ( RowNameKey.IsEmpty() || !( *Object )->TryGetStringField( RowNameKey, RowName ) || RowName.IsEmpty() )
+			RowName = FString::FromInt( i );
+
+		RowStruct->ClearScriptStruct( RowData.GetStructMemory() );
+		if ( !FJsonLibraryConverter::JsonObjectToUStruct( Object->ToSharedRef(), RowStruct, RowData.GetStructMemory() ) )
+			continue;
+
+		DataTable->AddRow( FName( *RowName ), *reinterpret_cast<const FTableRowBase*>( RowData.GetStructMemory() ) );
+	}
+
+	return true;
+}
+
+FJsonLibraryList FJsonLibraryList::FromDataTable( const UDataTable* DataTable, const FString& RowNameKey /*= TEXT( "Name" )*/ )
+{
+	if ( !DataTable || !DataTable->GetRowStruct() )
+		return FJsonLibraryList( TSharedPtr<FJsonValueArray>() );
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+
+	FJsonLibraryList List;
+	TArray<TSharedPtr<FJsonValue>>* Json = List.SetJsonArray();
+	Json->Reserve( RowMap.Num() );
+
+	for ( const TPair<FName, uint8*>& Row : RowMap )
+	{
+		TSharedRef<FJsonObject> Object = MakeShareable( new FJsonObject() );
+		if ( !FJsonLibraryConverter::UStructToJsonObject( RowStruct, Row.Value, Object ) )
+			continue;
+
+		if ( !RowNameKey.IsEmpty() )
+			Object->SetStringField( RowNameKey, Row.Key.ToString() );
+
+		Json->Add( MakeShareable( new FJsonValueObject( Object ) ) );
+	}
+
+	return List;
+}
+
 bool FJsonLibraryList::operator==( const FJsonLibraryList& List ) const
 {
 	return Equals( List );
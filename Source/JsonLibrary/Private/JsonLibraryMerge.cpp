@@ -0,0 +1,278 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryMerge.h"
+#include "JsonLibraryQuery.h"
+
+namespace
+{
+	const TArray<TSharedPtr<FJsonValue>>* GetArray( const FJsonValue* Value )
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Array;
+		if ( Value && Value->Type == EJson::Array && Value->TryGetArray( Array ) )
+			return Array;
+
+		return nullptr;
+	}
+
+	FJsonObject* GetObject( const FJsonValue* Value )
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if ( Value && Value->Type == EJson::Object && Value->TryGetObject( Object ) && Object )
+			return Object->Get();
+
+		return nullptr;
+	}
+
+	const TSharedPtr<FJsonValue>* FindField( const FJsonValue* Item, const FString& Key )
+	{
+		const FJsonObject* Object = GetObject( Item );
+		return Object ? Object->Values.Find( Key ) : nullptr;
+	}
+}
+
+TSharedPtr<FJsonValue> FJsonLibraryMerge::Copy( const FJsonValue* Value )
+{
+	if ( !Value )
+		return TSharedPtr<FJsonValue>();
+
+	switch ( Value->Type )
+	{
+		case EJson::Null:    return MakeShareable( new FJsonValueNull() );
+		case EJson::Boolean: return MakeShareable( new FJsonValueBoolean( Value->AsBool() ) );
+		case EJson::Number:  return MakeShareable( new FJsonValueNumber( Value->AsNumber() ) );
+		case EJson::String:  return MakeShareable( new FJsonValueString( Value->AsString() ) );
+		case EJson::Array:
+		{
+			TArray<TSharedPtr<FJsonValue>> Array;
+			if ( const TArray<TSharedPtr<FJsonValue>>* SourceArray = GetArray( Value ) )
+			{
+				Array.Reserve( SourceArray->Num() );
+				for ( const TSharedPtr<FJsonValue>& Item : *SourceArray )
+					Array.Add( Copy( Item.Get() ) );
+			}
+
+			return MakeShareable( new FJsonValueArray( Array ) );
+		}
+		case EJson::Object:
+		{
+			TSharedPtr<FJsonObject> Object = MakeShareable( new FJsonObject() );
+			if ( const FJsonObject* SourceObject = GetObject( Value ) )
+			{
+				Object->Values.Reserve( SourceObject->Values.Num() );
+				for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : SourceObject->Values )
+					Object->Values.Add( Temp.Key, Copy( Temp.Value.Get() ) );
+			}
+
+			return MakeShareable( new FJsonValueObject( Object ) );
+		}
+	}
+
+	return TSharedPtr<FJsonValue>();
+}
+
+bool FJsonLibraryMerge::Equals( const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B )
+{
+	if ( A == B )
+		return true;
+	if ( !A.IsValid() || !B.IsValid() || A->Type != B->Type )
+		return false;
+
+	switch ( A->Type )
+	{
+		case EJson::None:
+		case EJson::Null:    return true;
+		case EJson::Boolean: return A->AsBool()   == B->AsBool();
+		case EJson::Number:  return A->AsNumber() == B->AsNumber();
+		case EJson::String:  return A->AsString() == B->AsString();
+		case EJson::Array:
+		{
+			const TArray<TSharedPtr<FJsonValue>>* ArrayA = GetArray( A.Get() );
+			const TArray<TSharedPtr<FJsonValue>>* ArrayB = GetArray( B.Get() );
+			if ( !ArrayA || !ArrayB )
+				return ArrayA == ArrayB;
+			if ( ArrayA->Num() != ArrayB->Num() )
+				return false;
+
+			for ( int32 i = 0; i < ArrayA->Num(); i++ )
+				if ( !Equals( ( *ArrayA )[ i ], ( *ArrayB )[ i ] ) )
+					return false;
+
+			return true;
+		}
+		case EJson::Object:
+		{
+			const FJsonObject* ObjectA = GetObject( A.Get() );
+			const FJsonObject* ObjectB = GetObject( B.Get() );
+			if ( !ObjectA || !ObjectB )
+				return ObjectA == ObjectB;
+			if ( ObjectA->Values.Num() != ObjectB->Values.Num() )
+				return false;
+
+			for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectA->Values )
+			{
+				const TSharedPtr<FJsonValue>* Field = ObjectB->Values.Find( Temp.Key );
+				if ( !Field || !Equals( Temp.Value, *Field ) )
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FJsonLibraryMerge::DeepMerge( TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Source, EJsonLibraryArrayMerge Arrays, const FString& ArrayKey )
+{
+	if ( !Source.IsValid() || Source->Type == EJson::None )
+		return false;
+
+	// merge objects in place
+	FJsonObject* TargetObject = GetObject( Target.Get() );
+	FJsonObject* SourceObject = GetObject( Source.Get() );
+	if ( TargetObject && SourceObject )
+		return DeepMergeObject( *TargetObject, *SourceObject, Arrays, ArrayKey );
+
+	// merge arrays in place
+	if ( Arrays != EJsonLibraryArrayMerge::Replace )
+	{
+		const TArray<TSharedPtr<FJsonValue>>* TargetArray = GetArray( Target.Get() );
+		const TArray<TSharedPtr<FJsonValue>>* SourceArray = GetArray( Source.Get() );
+		if ( TargetArray && SourceArray )
+			return DeepMergeArray( *const_cast<TArray<TSharedPtr<FJsonValue>>*>( TargetArray ), *SourceArray, Arrays, ArrayKey );
+	}
+
+	if ( Equals( Target, Source ) )
+		return false;
+
+	Target = Copy( Source.Get() );
+	return true;
+}
+
+bool FJsonLibraryMerge::DeepMergeObject( FJsonObject& Target, const FJsonObject& Source, EJsonLibraryArrayMerge Arrays, const FString& ArrayKey )
+{
+	if ( &Target == &Source )
+		return false;
+
+	bool bChanged = false;
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Source.Values )
+		if ( Temp.Value.IsValid() && Temp.Value->Type != EJson::None )
+			bChanged |= DeepMerge( Target.Values.FindOrAdd( Temp.Key ), Temp.Value, Arrays, ArrayKey );
+
+	return bChanged;
+}
+
+bool FJsonLibraryMerge::DeepMergeArray( TArray<TSharedPtr<FJsonValue>>& Target, const TArray<TSharedPtr<FJsonValue>>& Source, EJsonLibraryArrayMerge Arrays, const FString& ArrayKey )
+{
+	if ( &Target == &Source || Source.Num() <= 0 )
+		return false;
+
+	if ( Arrays == EJsonLibraryArrayMerge::Concat )
+	{
+		Target.Reserve( Target.Num() + Source.Num() );
+		for ( const TSharedPtr<FJsonValue>& Item : Source )
+			Target.Add( Copy( Item.Get() ) );
+
+		return true;
+	}
+
+	bool bChanged = false;
+	if ( ArrayKey.IsEmpty() )
+	{
+		// merge items by index
+		for ( int32 i = 0; i < Source.Num(); i++ )
+		{
+			if ( Target.IsValidIndex( i ) )
+				bChanged |= DeepMerge( Target[ i ], Source[ i ], Arrays, ArrayKey );
+			else
+			{
+				Target.Add( Copy( Source[ i ].Get() ) );
+				bChanged = true;
+			}
+		}
+
+		return bChanged;
+	}
+
+	// merge items that share the same key, and append the rest
+	TMap<FString, int32> Indices;
+	Indices.Reserve( Target.Num() );
+	for ( int32 i = 0; i < Target.Num(); i++ )
+		if ( const TSharedPtr<FJsonValue>* Field = FindField( Target[ i ].Get(), ArrayKey ) )
+			Indices.Add( FJsonLibraryQuery::GetKey( *Field, true ), i );
+
+	for ( const TSharedPtr<FJsonValue>& Item : Source )
+	{
+		const TSharedPtr<FJsonValue>* Field = FindField( Item.Get(), ArrayKey );
+		const int32* Index = Field ? Indices.Find( FJsonLibraryQuery::GetKey( *Field, true ) ) : nullptr;
+		if ( Index )
+			bChanged |= DeepMerge( Target[ *Index ], Item, Arrays, ArrayKey );
+		else
+		{
+			Target.Add( Copy( Item.Get() ) );
+			bChanged = true;
+		}
+	}
+
+	return bChanged;
+}
+
+bool FJsonLibraryMerge::ApplyPatch( TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch )
+{
+	if ( !Patch.IsValid() || Patch->Type == EJson::None )
+		return false;
+
+	const FJsonObject* PatchObject = GetObject( Patch.Get() );
+	if ( !PatchObject )
+	{
+		if ( Equals( Target, Patch ) )
+			return false;
+
+		Target = Copy( Patch.Get() );
+		return true;
+	}
+
+	bool bChanged = false;
+	FJsonObject* TargetObject = GetObject( Target.Get() );
+	if ( !TargetObject )
+	{
+		TSharedPtr<FJsonObject> Object = MakeShareable( new FJsonObject() );
+		TargetObject = Object.Get();
+
+		Target = MakeShareable( new FJsonValueObject( Object ) );
+		bChanged = true;
+	}
+
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : PatchObject->Values )
+	{
+		if ( !Temp.Value.IsValid() || Temp.Value->Type == EJson::None || Temp.Value->Type == EJson::Null )
+			bChanged |= TargetObject->Values.Remove( Temp.Key ) > 0;
+		else
+			bChanged |= ApplyPatch( TargetObject->Values.FindOrAdd( Temp.Key ), Temp.Value );
+	}
+
+	return bChanged;
+}
+
+TSharedPtr<FJsonObject> FJsonLibraryMerge::CreatePatch( const FJsonObject& Source, const FJsonObject& Target )
+{
+	TSharedPtr<FJsonObject> Patch = MakeShareable( new FJsonObject() );
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Source.Values )
+		if ( !Target.Values.Contains( Temp.Key ) )
+			Patch->Values.Add( Temp.Key, MakeShareable( new FJsonValueNull() ) );
+
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : Target.Values )
+	{
+		const TSharedPtr<FJsonValue>* Field = Source.Values.Find( Temp.Key );
+		if ( Field && Equals( *Field, Temp.Value ) )
+			continue;
+
+		const FJsonObject* SourceObject = Field ? GetObject( Field->Get() ) : nullptr;
+		const FJsonObject* TargetObject = GetObject( Temp.Value.Get() );
+		if ( SourceObject && TargetObject )
+			Patch->Values.Add( Temp.Key, MakeShareable( new FJsonValueObject( CreatePatch( *SourceObject, *TargetObject ) ) ) );
+		else
+			Patch->Values.Add( Temp.Key, Copy( Temp.Value.Get() ) );
+	}
+
+	return Patch;
+}
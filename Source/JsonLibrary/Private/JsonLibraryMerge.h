@@ -0,0 +1,30 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "JsonLibraryEnums.h"
+
+// Native helpers for merging JSON values in place.
+// Values that are merged in are copied, so the source is never shared with the target.
+class FJsonLibraryMerge
+{
+public:
+
+	// Deep copy a value.
+	static TSharedPtr<FJsonValue> Copy( const FJsonValue* Value );
+	// Check if two values are strictly equal.
+	static bool Equals( const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B );
+
+	// Deep merge a value into a value, returning true if it changed.
+	static bool DeepMerge( TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Source, EJsonLibraryArrayMerge Arrays, const FString& ArrayKey );
+
+	// Apply a JSON merge patch (RFC 7396) to a value, returning true if it changed.
+	static bool ApplyPatch( TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch );
+	// Create a JSON merge patch (RFC 7396) that turns one object into another.
+	static TSharedPtr<FJsonObject> CreatePatch( const FJsonObject& Source, const FJsonObject& Target );
+
+private:
+
+	static bool DeepMergeObject( FJsonObject& Target, const FJsonObject& Source, EJsonLibraryArrayMerge Arrays, const FString& ArrayKey );
+	static bool DeepMergeArray( TArray<TSharedPtr<FJsonValue>>& Target, const TArray<TSharedPtr<FJsonValue>>& Source, EJsonLibraryArrayMerge Arrays, const FString& ArrayKey );
+};
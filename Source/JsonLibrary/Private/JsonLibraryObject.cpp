@@ -1,8 +1,11 @@
 // Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
 #include "JsonLibraryObject.h"
 #include "JsonLibraryConverter.h"
+#include "JsonLibraryFrozenValue.h"
 #include "JsonLibraryList.h"
 #include "JsonLibraryHelpers.h"
+#include "JsonLibraryLazy.h"
+#include "JsonLibraryMerge.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Policies/PrettyJsonPrintPolicy.h"
 
@@ -327,6 +330,62 @@ void FJsonLibraryObject::Add( const FJsonLibraryObject& Object )
 		SetValue( Temp.Key, FJsonLibraryValue( Temp.Value ) );
 }
 
+void FJsonLibraryObject::DeepMerge( const FJsonLibraryObject& Object, EJsonLibraryArrayMerge Arrays /*= EJsonLibraryArrayMerge::Replace*/, const FString& ArrayKey /*= FString()*/ )
+{
+	TSharedPtr<FJsonObject> Json = SetJsonObject();
+	const TSharedPtr<FJsonObject> ObjectJson = Object.GetJsonObject();
+	if ( !Json.IsValid() || !ObjectJson.IsValid() || Json == ObjectJson )
+		return;
+
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : ObjectJson->Values )
+	{
+		if ( !Temp.Value.IsValid() || Temp.Value->Type == EJson::None )
+			continue;
+
+		const bool bHasKey = Json->Values.Contains( Temp.Key );
+		TSharedPtr<FJsonValue>& Field = Json->Values.FindOrAdd( Temp.Key );
+
+		if ( FJsonLibraryMerge::DeepMerge( Field, Temp.Value, Arrays, ArrayKey ) )
+			NotifyMerge( bHasKey ? EJsonLibraryNotifyAction::Changed : EJsonLibraryNotifyAction::Added, Temp.Key, Field );
+	}
+}
+
+void FJsonLibraryObject::MergePatch( const FJsonLibraryObject& Patch )
+{
+	TSharedPtr<FJsonObject> Json = SetJsonObject();
+	const TSharedPtr<FJsonObject> PatchJson = Patch.GetJsonObject();
+	if ( !Json.IsValid() || !PatchJson.IsValid() || Json == PatchJson )
+		return;
+
+	for ( const TPair<FString, TSharedPtr<FJsonValue>>& Temp : PatchJson->Values )
+	{
+		if ( !Temp.Value.IsValid() || Temp.Value->Type == EJson::None || Temp.Value->Type == EJson::Null )
+		{
+			TSharedPtr<FJsonValue> Removed;
+			if ( Json->Values.RemoveAndCopyValue( Temp.Key, Removed ) )
+				NotifyMerge( EJsonLibraryNotifyAction::Removed, Temp.Key, Removed );
+
+			continue;
+		}
+
+		const bool bHasKey = Json->Values.Contains( Temp.Key );
+		TSharedPtr<FJsonValue>& Field = Json->Values.FindOrAdd( Temp.Key );
+
+		if ( FJsonLibraryMerge::ApplyPatch( Field, Temp.Value ) )
+			NotifyMerge( bHasKey ? EJsonLibraryNotifyAction::Changed : EJsonLibraryNotifyAction::Added, Temp.Key, Field );
+	}
+}
+
+FJsonLibraryObject FJsonLibraryObject::CreateMergePatch( const FJsonLibraryObject& Object ) const
+{
+	const TSharedPtr<FJsonObject> Json = GetJsonObject();
+	const TSharedPtr<FJsonObject> ObjectJson = Object.GetJsonObject();
+	if ( !Json.IsValid() || !ObjectJson.IsValid() )
+		return FJsonLibraryObject( TSharedPtr<FJsonValueObject>() );
+
+	return FJsonLibraryObject( MakeShareable( new FJsonValueObject( FJsonLibraryMerge::CreatePatch( *Json, *ObjectJson ) ) ) );
+}
+
 void FJsonLibraryObject::AddBooleanMap( const TMap<FString, bool>& Map )
 {
 	for ( const TPair<FString, bool>& Temp : Map )
@@ -650,6 +709,10 @@ bool FJsonLibraryObject::TryParse( const FString& Text, bool bStripComments /*=
 
 bool FJsonLibraryObject::TryStringify( FString& Text, bool bCondensed /*= true*/ ) const
 {
+	// untouched lazy objects keep their original text
+	if ( FJsonLibraryLazy::TryGetText( JsonObject.Get(), Text, bCondensed ) )
+		return true;
+
 	const TSharedPtr<FJsonObject> Json = GetJsonObject();
 	if ( !Json.IsValid() )
 		return false;
@@ -772,6 +835,15 @@ void FJsonLibraryObject::NotifyRemove( const FString& Key )
 	NotifyValue.Reset();
 }
 
+void FJsonLibraryObject::NotifyMerge( EJsonLibraryNotifyAction Action, const FString& Key, const TSharedPtr<FJsonValue>& Value )
+{
+	if ( !OnNotify.IsBound() )
+		return;
+
+	// only properties that were actually changed are reported
+	OnNotify.Execute( FJsonLibraryValue( *this ), Action, Key, FJsonLibraryValue( Value ) );
+}
+
 bool FJsonLibraryObject::IsValid() const
 {
 	return GetJsonObject().IsValid();
@@ -902,6 +974,11 @@ FString FJsonLibraryObject::Stringify( bool bCondensed /*= true*/ ) const
 	return FString();
 }
 
+FJsonLibraryFrozenValue FJsonLibraryObject::Freeze() const
+{
+	return FJsonLibraryValue( *this ).Freeze();
+}
+
 
 bool FJsonLibraryObject::ToStruct( const UStruct* StructType, void* StructPtr ) const
 {
@@ -0,0 +1,540 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "JsonLibraryQuery.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace
+{
+	int32 GetTypeOrder( const FJsonValue* Value )
+	{
+		if ( !Value )
+			return 0;
+
+		switch ( Value->Type )
+		{
+			case EJson::Null:    return 1;
+			case EJson::Boolean: return 2;
+			case EJson::Number:  return 3;
+			case EJson::String:  return 4;
+			case EJson::Array:   return 5;
+			case EJson::Object:  return 6;
+		}
+
+		return 0;
+	}
+
+	bool IsNullOrMissing( const FJsonValue* Value )
+	{
+		return !Value || Value->Type == EJson::None || Value->Type == EJson::Null;
+	}
+}
+
+const FJsonValue* FJsonLibraryQuery::FindField( const FJsonValue* Item, const FString& Key )
+{
+	if ( !Item || Key.IsEmpty() )
+		return Item;
+
+	const TSharedPtr<FJsonObject>* Object;
+	if ( Item->Type != EJson::Object || !Item->TryGetObject( Object ) || !Object || !Object->IsValid() )
+		return nullptr;
+
+	const TSharedPtr<FJsonValue>* Field = ( *Object )->Values.Find( Key );
+	if ( !Field )
+		return nullptr;
+
+	return Field->Get();
+}
+
+const FJsonValue* FJsonLibraryQuery::FindPath( const FJsonValue* Item, const TArray<FString>& Path )
+{
+	for ( int32 i = 0; i < Path.Num() && Item; i++ )
+		Item = FindField( Item, Path[ i ] );
+
+	return Item;
+}
+
+TSharedPtr<FJsonValue> FJsonLibraryQuery::FindPath( const TSharedPtr<FJsonValue>& Item, const TArray<FString>& Path )
+{
+	TSharedPtr<FJsonValue> Value = Item;
+	for ( int32 i = 0; i < Path.Num() && Value.IsValid(); i++ )
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if ( Value->Type != EJson::Object || !Value->TryGetObject( Object ) || !Object || !Object->IsValid() )
+			return TSharedPtr<FJsonValue>();
+
+		Value = ( *Object )->TryGetField( Path[ i ] );
+	}
+
+	return Value;
+}
+
+void FJsonLibraryQuery::ParsePath( const FString& Key, TArray<FString>& Path )
+{
+	// "@" refers to the item itself
+	if ( Key.StartsWith( TEXT( "@" ) ) )
+		Key.RightChop( 1 ).ParseIntoArray( Path, TEXT( "." ), true );
+	else
+		Key.ParseIntoArray( Path, TEXT( "." ), true );
+}
+
+int32 FJsonLibraryQuery::Compare( const FJsonValue* A, const FJsonValue* B )
+{
+	double NumberA, NumberB;
+	if ( TryGetNumber( A, NumberA ) && TryGetNumber( B, NumberB ) )
+	{
+		if ( NumberA != NumberB )
+			return NumberA < NumberB ? -1 : 1;
+
+		if ( A->Type == B->Type )
+			return 0;
+	}
+	else if ( A && B && A->Type == EJson::String && B->Type == EJson::String )
+	{
+		const FString StringA = A->AsString();
+		const FString StringB = B->AsString();
+
+		int32 Result = StringA.Compare( StringB, ESearchCase::IgnoreCase );
+		if ( Result == 0 )
+			Result = StringA.Compare( StringB, ESearchCase::CaseSensitive );
+
+		return FMath::Clamp( Result, -1, 1 );
+	}
+	else if ( A && B && A->Type == EJson::Boolean && B->Type == EJson::Boolean )
+		return (int32)A->AsBool() - (int32)B->AsBool();
+
+	const int32 OrderA = GetTypeOrder( A );
+	const int32 OrderB = GetTypeOrder( B );
+	if ( OrderA != OrderB )
+		return OrderA < OrderB ? -1 : 1;
+
+	return 0;
+}
+
+bool FJsonLibraryQuery::Equals( const FJsonValue* A, const FJsonValue* B )
+{
+	if ( IsNullOrMissing( A ) || IsNullOrMissing( B ) )
+		return IsNullOrMissing( A ) && IsNullOrMissing( B );
+
+	if ( A == B )
+		return true;
+
+	if ( A->Type == EJson::Number || B->Type == EJson::Number )
+	{
+		double NumberA, NumberB;
+		if ( TryGetNumber( A, NumberA ) && TryGetNumber( B, NumberB ) )
+			return NumberA == NumberB;
+
+		return false;
+	}
+
+	if ( A->Type != B->Type )
+		return false;
+
+	switch ( A->Type )
+	{
+		case EJson::Boolean: return A->AsBool() == B->AsBool();
+		case EJson::String:  return A->AsString() == B->AsString();
+	}
+
+	return false;
+}
+
+bool FJsonLibraryQuery::IsTruthy( const FJsonValue* Value )
+{
+	if ( !Value )
+		return false;
+
+	switch ( Value->Type )
+	{
+		case EJson::Boolean: return Value->AsBool();
+		case EJson::Number:  return Value->AsNumber() != 0.0;
+		case EJson::String:  return !Value->AsString().IsEmpty();
+		case EJson::Array:   return true;
+		case EJson::Object:  return true;
+	}
+
+	return false;
+}
+
+bool FJsonLibraryQuery::TryGetNumber( const FJsonValue* Value, double& Number )
+{
+	if ( !Value )
+		return false;
+
+	if ( Value->Type == EJson::Number )
+	{
+		Number = Value->AsNumber();
+		return true;
+	}
+
+	if ( Value->Type == EJson::String )
+	{
+		const FString String = Value->AsString();
+		if ( String.IsEmpty() || !String.IsNumeric() )
+			return false;
+
+		Number = FCString::Atod( *String );
+		return true;
+	}
+
+	return false;
+}
+
+FString FJsonLibraryQuery::GetKey( const TSharedPtr<FJsonValue>& Value, bool bTyped )
+{
+	if ( !Value.IsValid() )
+		return bTyped ? TEXT( "_" ) : TEXT( "null" );
+
+	switch ( Value->Type )
+	{
+		case EJson::Null:    return bTyped ? TEXT( "_" ) : TEXT( "null" );
+		case EJson::Boolean: return ( bTyped ? TEXT( "b" ) : TEXT( "" ) ) + FString( Value->AsBool() ? TEXT( "true" ) : TEXT( "false" ) );
+		case EJson::Number:  return ( bTyped ? TEXT( "n" ) : TEXT( "" ) ) + FString::SanitizeFloat( Value->AsNumber(), 0 );
+		case EJson::String:  return ( bTyped ? TEXT( "s" ) : TEXT( "" ) ) + Value->AsString();
+	}
+
+	FString Text;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create( &Text );
+
+	if ( Value->Type == EJson::Object )
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if ( Value->TryGetObject( Object ) && Object && Object->IsValid() )
+			FJsonSerializer::Serialize( Object->ToSharedRef(), Writer );
+	}
+	else if ( Value->Type == EJson::Array )
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Array;
+		if ( Value->TryGetArray( Array ) && Array )
+			FJsonSerializer::Serialize( *Array, Writer );
+	}
+
+	return ( bTyped ? TEXT( "j" ) : TEXT( "" ) ) + Text;
+}
+
+class FJsonLibraryPredicateParser
+{
+	typedef FJsonLibraryPredicate::EOperator EOperator;
+
+public:
+
+	FJsonLibraryPredicateParser( const FString& InText, FJsonLibraryPredicate& InPredicate )
+		: Text( InText )
+		, Predicate( InPredicate )
+		, Position( 0 )
+	{
+	}
+
+	bool Parse()
+	{
+		Predicate.Root = ParseOr();
+		SkipWhitespace();
+
+		return Predicate.Root != INDEX_NONE && Position >= Text.Len();
+	}
+
+private:
+
+	const FString& Text;
+	FJsonLibraryPredicate& Predicate;
+	int32 Position;
+
+	void SkipWhitespace()
+	{
+		while ( Position < Text.Len() && FChar::IsWhitespace( Text[ Position ] ) )
+			Position++;
+	}
+
+	bool Match( const TCHAR* Token )
+	{
+		SkipWhitespace();
+
+		const int32 Length = FCString::Strlen( Token );
+		if ( Text.Len() - Position < Length )
+			return false;
+
+		if ( FCString::Strncmp( *Text + Position, Token, Length ) != 0 )
+			return false;
+
+		Position += Length;
+		return true;
+	}
+
+	int32 AddNode( EOperator Operator, int32 Left = INDEX_NONE, int32 Right = INDEX_NONE )
+	{
+		FJsonLibraryPredicate::FNode Node;
+		Node.Operator = Operator;
+		Node.Left     = Left;
+		Node.Right    = Right;
+
+		return Predicate.Nodes.Add( Node );
+	}
+
+	int32 AddLiteral( const TSharedPtr<FJsonValue>& Value )
+	{
+		const int32 Index = AddNode( EOperator::Literal );
+		Predicate.Nodes[ Index ].Literal = Value;
+
+		return Index;
+	}
+
+	int32 ParseOr()
+	{
+		int32 Left = ParseAnd();
+		while ( Left != INDEX_NONE && Match( TEXT( "||" ) ) )
+		{
+			const int32 Right = ParseAnd();
+			if ( Right == INDEX_NONE )
+				return INDEX_NONE;
+
+			Left = AddNode( EOperator::Or, Left, Right );
+		}
+
+		return Left;
+	}
+
+	int32 ParseAnd()
+	{
+		int32 Left = ParseUnary();
+		while ( Left != INDEX_NONE && Match( TEXT( "&&" ) ) )
+		{
+			const int32 Right = ParseUnary();
+			if ( Right == INDEX_NONE )
+				return INDEX_NONE;
+
+			Left = AddNode( EOperator::And, Left, Right );
+		}
+
+		return Left;
+	}
+
+	int32 ParseUnary()
+	{
+		SkipWhitespace();
+		if ( Position + 1 < Text.Len() && Text[ Position ] == '!' && Text[ Position + 1 ] != '=' )
+		{
+			Position++;
+
+			const int32 Operand = ParseUnary();
+			if ( Operand == INDEX_NONE )
+				return INDEX_NONE;
+
+			return AddNode( EOperator::Not, Operand );
+		}
+
+		return ParseComparison();
+	}
+
+	int32 ParseComparison()
+	{
+		const int32 Left = ParseOperand();
+		if ( Left == INDEX_NONE )
+			return INDEX_NONE;
+
+		EOperator Operator;
+		if ( Match( TEXT( "==" ) ) )
+			Operator = EOperator::Equal;
+		else if ( Match( TEXT( "!=" ) ) )
+			Operator = EOperator::NotEqual;
+		else if ( Match( TEXT( "<=" ) ) )
+			Operator = EOperator::LessEqual;
+		else if ( Match( TEXT( ">=" ) ) )
+			Operator = EOperator::GreaterEqual;
+		else if ( Match( TEXT( "<" ) ) )
+			Operator = EOperator::Less;
+		else if ( Match( TEXT( ">" ) ) )
+			Operator = EOperator::Greater;
+		else
+			return Left;
+
+		const int32 Right = ParseOperand();
+		if ( Right == INDEX_NONE )
+			return INDEX_NONE;
+
+		return AddNode( Operator, Left, Right );
+	}
+
+	int32 ParseOperand()
+	{
+		SkipWhitespace();
+		if ( Position >= Text.Len() )
+			return INDEX_NONE;
+
+		const TCHAR Character = Text[ Position ];
+		if ( Character == '(' )
+		{
+			Position++;
+
+			const int32 Node = ParseOr();
+			if ( Node == INDEX_NONE || !Match( TEXT( ")" ) ) )
+				return INDEX_NONE;
+
+			return Node;
+		}
+
+		if ( Character == '"' || Character == '\'' )
+			return ParseString( Character );
+		if ( FChar::IsDigit( Character ) || Character == '-' || Character == '.' )
+			return ParseNumber();
+		if ( FChar::IsAlpha( Character ) || Character == '_' || Character == '@' )
+			return ParseIdentifier();
+
+		return INDEX_NONE;
+	}
+
+	int32 ParseString( TCHAR Quote )
+	{
+		FString Value;
+		for ( Position++; Position < Text.Len(); Position++ )
+		{
+			TCHAR Character = Text[ Position ];
+			if ( Character == Quote )
+			{
+				Position++;
+				return AddLiteral( MakeShareable( new FJsonValueString( Value ) ) );
+			}
+
+			if ( Character == '\\' && Position + 1 < Text.Len() )
+			{
+				Character = Text[ ++Position ];
+				switch ( Character )
+				{
+					case 'n': Character = '\n'; break;
+					case 'r': Character = '\r'; break;
+					case 't': Character = '\t'; break;
+				}
+			}
+
+			Value.AppendChar( Character );
+		}
+
+		return INDEX_NONE;
+	}
+
+	int32 ParseNumber()
+	{
+		const int32 Start = Position;
+		if ( Text[ Position ] == '-' )
+			Position++;
+
+		bool bDigits = false;
+		while ( Position < Text.Len() )
+		{
+			const TCHAR Character = Text[ Position ];
+			if ( FChar::IsDigit( Character ) )
+				bDigits = true;
+			else if ( Character == 'e' || Character == 'E' )
+			{
+				if ( Position + 1 < Text.Len() && ( Text[ Position + 1 ] == '-' || Text[ Position + 1 ] == '+' ) )
+					Position++;
+			}
+			else if ( Character != '.' )
+				break;
+
+			Position++;
+		}
+
+		if ( !bDigits )
+			return INDEX_NONE;
+
+		const FString Number = Text.Mid( Start, Position - Start );
+		return AddLiteral( MakeShareable( new FJsonValueNumber( FCString::Atod( *Number ) ) ) );
+	}
+
+	int32 ParseIdentifier()
+	{
+		const int32 Start = Position;
+		while ( Position < Text.Len() )
+		{
+			const TCHAR Character = Text[ Position ];
+			if ( !FChar::IsAlnum( Character ) && Character != '_' && Character != '.' && Character != '@' )
+				break;
+
+			Position++;
+		}
+
+		FString Identifier = Text.Mid( Start, Position - Start );
+		if ( Identifier == TEXT( "true" ) )
+			return AddLiteral( MakeShareable( new FJsonValueBoolean( true ) ) );
+		if ( Identifier == TEXT( "false" ) )
+			return AddLiteral( MakeShareable( new FJsonValueBoolean( false ) ) );
+		if ( Identifier == TEXT( "null" ) )
+			return AddLiteral( MakeShareable( new FJsonValueNull() ) );
+
+		const int32 Index = AddNode( EOperator::Field );
+		FJsonLibraryQuery::ParsePath( Identifier, Predicate.Nodes[ Index ].Path );
+
+		return Index;
+	}
+};
+
+TSharedPtr<FJsonLibraryPredicate> FJsonLibraryPredicate::Compile( const FString& Expression )
+{
+	TSharedPtr<FJsonLibraryPredicate> Predicate = MakeShareable( new FJsonLibraryPredicate() );
+
+	FJsonLibraryPredicateParser Parser( Expression, *Predicate );
+	if ( !Parser.Parse() )
+		return TSharedPtr<FJsonLibraryPredicate>();
+
+	return Predicate;
+}
+
+bool FJsonLibraryPredicate::Evaluate( const FJsonValue* Item ) const
+{
+	if ( !Nodes.IsValidIndex( Root ) )
+		return false;
+
+	return EvaluateNode( Root, Item );
+}
+
+const FJsonValue* FJsonLibraryPredicate::Resolve( int32 Index, const FJsonValue* Item ) const
+{
+	static const FJsonValueBoolean True( true );
+	static const FJsonValueBoolean False( false );
+
+	const FNode& Node = Nodes[ Index ];
+	switch ( Node.Operator )
+	{
+		case EOperator::Field:   return FJsonLibraryQuery::FindPath( Item, Node.Path );
+		case EOperator::Literal: return Node.Literal.Get();
+	}
+
+	return EvaluateNode( Index, Item ) ? &True : &False;
+}
+
+bool FJsonLibraryPredicate::EvaluateNode( int32 Index, const FJsonValue* Item ) const
+{
+	const FNode& Node = Nodes[ Index ];
+	switch ( Node.Operator )
+	{
+		case EOperator::Field:    return FJsonLibraryQuery::IsTruthy( Resolve( Index, Item ) );
+		case EOperator::Literal:  return FJsonLibraryQuery::IsTruthy( Node.Literal.Get() );
+		case EOperator::Not:      return !EvaluateNode( Node.Left, Item );
+		case EOperator::And:      return EvaluateNode( Node.Left, Item ) && EvaluateNode( Node.Right, Item );
+		case EOperator::Or:       return EvaluateNode( Node.Left, Item ) || EvaluateNode( Node.Right, Item );
+		case EOperator::Equal:    return FJsonLibraryQuery::Equals( Resolve( Node.Left, Item ), Resolve( Node.Right, Item ) );
+		case EOperator::NotEqual: return !FJsonLibraryQuery::Equals( Resolve( Node.Left, Item ), Resolve( Node.Right, Item ) );
+	}
+
+	const FJsonValue* Left  = Resolve( Node.Left, Item );
+	const FJsonValue* Right = Resolve( Node.Right, Item );
+	if ( IsNullOrMissing( Left ) || IsNullOrMissing( Right ) )
+		return false;
+
+	// only order values that are comparable
+	double NumberA, NumberB;
+	const bool bNumeric = FJsonLibraryQuery::TryGetNumber( Left, NumberA ) && FJsonLibraryQuery::TryGetNumber( Right, NumberB );
+	if ( !bNumeric && Left->Type != Right->Type )
+		return false;
+
+	const int32 Result = FJsonLibraryQuery::Compare( Left, Right );
+	switch ( Node.Operator )
+	{
+		case EOperator::Less:         return Result < 0;
+		case EOperator::LessEqual:    return Result <= 0;
+		case EOperator::Greater:      return Result > 0;
+		case EOperator::GreaterEqual: return Result >= 0;
+	}
+
+	return false;
+}
@@ -0,0 +1,82 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+
+// Native helpers for querying lists of JSON values.
+// These work on raw values so that they can be used from worker threads.
+class FJsonLibraryQuery
+{
+public:
+
+	// Number of items before a query is split across worker threads.
+	static const int32 ParallelThreshold = 4096;
+
+	// Find a property of an item, or the item itself if the key is empty.
+	static const FJsonValue* FindField( const FJsonValue* Item, const FString& Key );
+	// Find a nested property of an item.
+	static const FJsonValue* FindPath( const FJsonValue* Item, const TArray<FString>& Path );
+	// Find a nested property of an item, keeping a reference to it.
+	static TSharedPtr<FJsonValue> FindPath( const TSharedPtr<FJsonValue>& Item, const TArray<FString>& Path );
+	// Split a dotted key into a path, where "@" refers to the item itself.
+	static void ParsePath( const FString& Key, TArray<FString>& Path );
+
+	// Compare two values for sorting.
+	static int32 Compare( const FJsonValue* A, const FJsonValue* B );
+	// Check if two values are equal.
+	static bool Equals( const FJsonValue* A, const FJsonValue* B );
+	// Check if a value is truthy.
+	static bool IsTruthy( const FJsonValue* Value );
+	// Get a value as a number.
+	static bool TryGetNumber( const FJsonValue* Value, double& Number );
+
+	// Get a string that identifies a value.
+	static FString GetKey( const TSharedPtr<FJsonValue>& Value, bool bTyped );
+};
+
+// Compiled predicate expression for filtering lists.
+class FJsonLibraryPredicate
+{
+public:
+
+	// Compile an expression, e.g. "score >= 100 && team == 'red'".
+	static TSharedPtr<FJsonLibraryPredicate> Compile( const FString& Expression );
+
+	// Evaluate this predicate against an item.
+	bool Evaluate( const FJsonValue* Item ) const;
+
+private:
+
+	enum class EOperator : uint8
+	{
+		Field,
+		Literal,
+		Not,
+		And,
+		Or,
+		Equal,
+		NotEqual,
+		Less,
+		LessEqual,
+		Greater,
+		GreaterEqual
+	};
+
+	struct FNode
+	{
+		EOperator Operator = EOperator::Literal;
+		int32 Left = INDEX_NONE;
+		int32 Right = INDEX_NONE;
+
+		TArray<FString> Path;
+		TSharedPtr<FJsonValue> Literal;
+	};
+
+	TArray<FNode> Nodes;
+	int32 Root = INDEX_NONE;
+
+	const FJsonValue* Resolve( int32 Index, const FJsonValue* Item ) const;
+	bool EvaluateNode( int32 Index, const FJsonValue* Item ) const;
+
+	friend class FJsonLibraryPredicateParser;
+};
@@ -2,7 +2,10 @@
 #include "JsonLibraryValue.h"
 #include "JsonLibraryObject.h"
 #include "JsonLibraryList.h"
+#include "JsonLibraryFrozenValue.h"
 #include "JsonLibraryHelpers.h"
+#include "JsonLibraryLazy.h"
+#include "JsonLibraryMerge.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Policies/PrettyJsonPrintPolicy.h"
 
@@ -488,6 +491,10 @@ bool FJsonLibraryValue::TryStringify( FString& Text, bool bCondensed /*= true*/
 {
 	if ( !JsonValue.IsValid() || JsonValue->Type == EJson::None )
 		return false;
+
+	// untouched lazy values keep their original text
+	if ( FJsonLibraryLazy::TryGetText( JsonValue.Get(), Text, bCondensed ) )
+		return true;
 	
 	if ( JsonValue->Type == EJson::Object )
 	{
@@ -678,6 +685,22 @@ FJsonLibraryValue FJsonLibraryValue::Parse( const FString& Text )
 	return Value;
 }
 
+FJsonLibraryValue FJsonLibraryValue::ParseLazy( const FString& Text )
+{
+	return ParseLazy( FString( Text ) );
+}
+
+FJsonLibraryValue FJsonLibraryValue::ParseLazy( FString&& Text )
+{
+	const FJsonLibraryLazyText Source = MakeShared<FString, ESPMode::ThreadSafe>( MoveTemp( Text ) );
+
+	TSharedPtr<FJsonValue> Value = FJsonLibraryLazy::Parse( Source );
+	if ( Value.IsValid() )
+		return FJsonLibraryValue( Value );
+
+	return Parse( *Source );
+}
+
 FJsonLibraryValue FJsonLibraryValue::ParseRelaxed( const FString& Text, bool bStripComments /*= true*/, bool bStripTrailingCommas /*= true*/ )
 {
 	FJsonLibraryValue Value = TSharedPtr<FJsonValue>();
@@ -696,6 +719,16 @@ FString FJsonLibraryValue::Stringify( bool bCondensed /*= true*/ ) const
 	return FString();
 }
 
+FJsonLibraryFrozenValue FJsonLibraryValue::Freeze() const
+{
+	return FJsonLibraryFrozenValue::Create( FJsonLibraryFrozenValue::Copy( JsonValue.Get() ) );
+}
+
+FJsonLibraryValue FJsonLibraryValue::Copy() const
+{
+	return FJsonLibraryValue( FJsonLibraryMerge::Copy( JsonValue.Get() ) );
+}
+
 TArray<FJsonLibraryValue> FJsonLibraryValue::ToArray() const
 {
 	return FJsonLibraryList( JsonValue ).ToArray();
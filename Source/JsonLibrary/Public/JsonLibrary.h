@@ -4,4 +4,6 @@
 #include "JsonLibraryValue.h"
 #include "JsonLibraryObject.h"
 #include "JsonLibraryList.h"
+#include "JsonLibraryColumns.h"
+#include "JsonLibraryFrozenValue.h"
 #include "JsonLibraryHelpers.h"
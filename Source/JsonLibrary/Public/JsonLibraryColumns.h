@@ -0,0 +1,70 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "JsonLibraryValue.h"
+
+// Schema of typed arrays used to extract the properties of a list of objects in a single pass.
+//
+//   TArray<FString> Names;
+//   TArray<float> Scores;
+//
+//   FJsonLibraryColumns Columns;
+//   Columns.Add( "name", Names ).Add( "score", Scores );
+//   List.ToColumns( Columns );
+//
+class JSONLIBRARY_API FJsonLibraryColumns
+{
+	friend struct FJsonLibraryList;
+
+public:
+
+	// Add a column of booleans.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<bool>& Column );
+	// Add a column of floats.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<float>& Column );
+	// Add a column of numbers.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<double>& Column );
+	// Add a column of integers.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<int32>& Column );
+	// Add a column of 64-bit integers.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<int64>& Column );
+	// Add a column of strings.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<FString>& Column );
+	// Add a column of names.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<FName>& Column );
+	// Add a column of vectors.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<FVector>& Column );
+	// Add a column of JSON values.
+	FJsonLibraryColumns& Add( const FString& Key, TArray<FJsonLibraryValue>& Column );
+
+	// Get the number of columns.
+	int32 Num() const;
+	// Get the number of rows in the longest column.
+	int32 GetRowCount() const;
+
+private:
+
+	enum class EColumnType : uint8
+	{
+		Boolean,
+		Float,
+		Number,
+		Integer,
+		Integer64,
+		String,
+		Name,
+		Vector,
+		Value
+	};
+
+	struct FColumn
+	{
+		FString Key;
+		EColumnType Type;
+		void* Array;
+	};
+
+	TArray<FColumn> Columns;
+
+	FJsonLibraryColumns& AddColumn( const FString& Key, EColumnType Type, void* Array );
+};
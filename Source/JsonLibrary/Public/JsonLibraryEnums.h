@@ -23,3 +23,11 @@ enum class EJsonLibraryNotifyAction : uint8
 	Changed	UMETA(DisplayName="Changed"),
 	Reset	UMETA(DisplayName="Reset")
 };
+
+UENUM(BlueprintType, meta = (DisplayName = "JSON Array Merge"))
+enum class EJsonLibraryArrayMerge : uint8
+{
+	Replace		UMETA(DisplayName="Replace"),
+	Concat		UMETA(DisplayName="Concat"),
+	MergeByKey	UMETA(DisplayName="Merge By Key")
+};
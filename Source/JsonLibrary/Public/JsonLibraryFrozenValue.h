@@ -0,0 +1,72 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "Dom/JsonValue.h"
+#include "Dom/JsonObject.h"
+#include "JsonLibraryEnums.h"
+#include "JsonLibraryValue.h"
+
+// Immutable JSON value that can be shared and read by any thread without locks.
+// Only the document is reference counted, and it uses a thread-safe reference count.
+// Use Thaw() to get a mutable copy.
+struct JSONLIBRARY_API FJsonLibraryFrozenValue
+{
+	friend struct FJsonLibraryValue;
+
+public:
+
+	FJsonLibraryFrozenValue();
+
+	// Get the JSON type of this value.
+	EJsonLibraryType GetType() const;
+
+	// Convert this value to a boolean.
+	bool GetBoolean() const;
+	// Convert this value to a float.
+	float GetFloat() const;
+	// Convert this value to an integer.
+	int32 GetInteger() const;
+	// Convert this value to a number.
+	double GetNumber() const;
+	// Convert this value to a string.
+	FString GetString() const;
+
+	// Get the number of items or properties in this value.
+	int32 Count() const;
+
+	// Check if this object has a property.
+	bool HasKey( const FString& Key ) const;
+	// Get the keys of this object as an array of strings.
+	TArray<FString> GetKeys() const;
+
+	// Get a property of this object.
+	FJsonLibraryFrozenValue GetValue( const FString& Key ) const;
+	// Get an item of this list.
+	FJsonLibraryFrozenValue GetItem( int32 Index ) const;
+
+	// Check if this value is valid.
+	bool IsValid() const;
+
+	// Parse a JSON string into a frozen value.
+	static FJsonLibraryFrozenValue Parse( const FString& Text );
+
+	// Stringify this value as a JSON string.
+	FString Stringify( bool bCondensed = true ) const;
+
+	// Copy this value to a mutable JSON value.
+	FJsonLibraryValue Thaw() const;
+
+private:
+
+	struct FDocument
+	{
+		TSharedPtr<FJsonValue> Root;
+	};
+
+	TSharedPtr<const FDocument, ESPMode::ThreadSafe> Document;
+	const FJsonValue* Value;
+
+	FJsonLibraryFrozenValue( const TSharedPtr<const FDocument, ESPMode::ThreadSafe>& InDocument, const FJsonValue* InValue );
+
+	static FJsonLibraryFrozenValue Create( TSharedPtr<FJsonValue>&& Root );
+	static TSharedPtr<FJsonValue> Copy( const FJsonValue* Source );
+};
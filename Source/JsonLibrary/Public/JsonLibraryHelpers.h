@@ -21,6 +21,9 @@ public:
 	// Parse a JSON string.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse", AdvancedDisplay = "bComments,bTrailingCommas"), Category = "JSON Library")
 	static FJsonLibraryValue Parse( const FString& Text, bool bComments = false, bool bTrailingCommas = false );
+	// Parse a large JSON string, only parsing objects and lists when they are accessed.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse Lazy"), Category = "JSON Library")
+	static FJsonLibraryValue ParseLazy( const FString& Text );
 	
 	// Parse a JSON object string.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Parse Object", AutoCreateRefTerm = "Notify", AdvancedDisplay = "Notify"), Category = "JSON Library|Object")
@@ -476,6 +479,15 @@ public:
 	// Add a JSON object to this object.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add"), Category = "JSON Library|Object")
 	static FJsonLibraryObject& JsonObject_Add( UPARAM(ref) FJsonLibraryObject& Target, const FJsonLibraryObject& Object );
+	// Deep merge a JSON object into this object.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Deep Merge", AdvancedDisplay = "Arrays,ArrayKey"), Category = "JSON Library|Object")
+	static FJsonLibraryObject& JsonObject_DeepMerge( UPARAM(ref) FJsonLibraryObject& Target, const FJsonLibraryObject& Object, EJsonLibraryArrayMerge Arrays, const FString& ArrayKey );
+	// Apply a JSON merge patch to this object.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Merge Patch"), Category = "JSON Library|Object")
+	static FJsonLibraryObject& JsonObject_MergePatch( UPARAM(ref) FJsonLibraryObject& Target, const FJsonLibraryObject& Patch );
+	// Create a JSON merge patch that turns this object into another.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Create Merge Patch"), Category = "JSON Library|Object")
+	static FJsonLibraryObject JsonObject_CreateMergePatch( const FJsonLibraryObject& Target, const FJsonLibraryObject& Object );
 
 	// Add a map of booleans to this object.
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Add Boolean Map"), Category = "JSON Library|Map")
@@ -1069,6 +1081,43 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Find List"), Category = "JSON Library|List")
 	static int32 JsonList_FindList( UPARAM(ref) const FJsonLibraryList& Target, const FJsonLibraryList& Value, int32 Index = 0 );
 
+	// Sort the items of this list by one or more properties.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Sort By Key", AdvancedDisplay = "bDescending"), Category = "JSON Library|List")
+	static FJsonLibraryList& JsonList_SortByKey( UPARAM(ref) FJsonLibraryList& Target, const TArray<FString>& Keys, bool bDescending = false );
+	// Copy the items of this list that match a predicate.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Filter By Predicate"), Category = "JSON Library|List")
+	static FJsonLibraryList JsonList_FilterByPredicate( UPARAM(ref) const FJsonLibraryList& Target, const FString& Predicate );
+	// Group the items of this list by a property, e.g. "team.name".
+	// Group keys are prefixed with the type of the value, e.g. "n1" or "s1".
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Group By"), Category = "JSON Library|List")
+	static FJsonLibraryObject JsonList_GroupBy( UPARAM(ref) const FJsonLibraryList& Target, const FString& Key );
+	// Copy the unique items of this list.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Distinct"), Category = "JSON Library|List")
+	static FJsonLibraryList JsonList_Distinct( UPARAM(ref) const FJsonLibraryList& Target );
+	// Copy a property from each item in this list, e.g. "team.name".
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Pluck"), Category = "JSON Library|List")
+	static FJsonLibraryList JsonList_Pluck( UPARAM(ref) const FJsonLibraryList& Target, const FString& Key );
+
+	// Get the sum of the numbers in this list.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Sum"), Category = "JSON Library|List")
+	static float JsonList_Sum( UPARAM(ref) const FJsonLibraryList& Target, const FString& Key );
+	// Get the minimum of the numbers in this list.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Min"), Category = "JSON Library|List")
+	static float JsonList_Min( UPARAM(ref) const FJsonLibraryList& Target, const FString& Key );
+	// Get the maximum of the numbers in this list.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Max"), Category = "JSON Library|List")
+	static float JsonList_Max( UPARAM(ref) const FJsonLibraryList& Target, const FString& Key );
+	// Get the average of the numbers in this list.
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Average"), Category = "JSON Library|List")
+	static float JsonList_Average( UPARAM(ref) const FJsonLibraryList& Target, const FString& Key );
+
+	// Copy the objects in this list to the rows of a data table.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Copy To Data Table", AdvancedDisplay = "RowNameKey"), Category = "JSON Library|List")
+	static bool JsonList_ToDataTable( UPARAM(ref) const FJsonLibraryList& Target, UDataTable* DataTable, const FString& RowNameKey = TEXT( "Name" ) );
+	// Copy the rows of a data table to a list of objects.
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Copy Data Table To List", AdvancedDisplay = "RowNameKey"), Category = "JSON Library|List")
+	static FJsonLibraryList ConvertDataTableToList( const UDataTable* DataTable, const FString& RowNameKey = TEXT( "Name" ) );
+
 	// Check if this list is valid.
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Valid"), Category = "JSON Library|List")
 	static bool JsonList_IsValid( UPARAM(ref) const FJsonLibraryList& Target );
@@ -10,6 +10,10 @@
 #include "JsonLibraryList.generated.h"
 
 typedef struct FJsonLibraryObject FJsonLibraryObject;
+typedef struct FJsonLibraryFrozenValue FJsonLibraryFrozenValue;
+
+class FJsonLibraryColumns;
+class UDataTable;
 
 DECLARE_DYNAMIC_DELEGATE_FourParams( FJsonLibraryListNotify, const FJsonLibraryValue&, List, EJsonLibraryNotifyAction, Action, int32, Index, const FJsonLibraryValue&, Value );
 
@@ -361,6 +365,27 @@ public:
 	// Find a JSON array in this list.
 	int32 FindList( const FJsonLibraryList& Value, int32 Index = 0 ) const;
 
+	// Sort the items of this list by one or more properties.
+	void SortByKey( const TArray<FString>& Keys, bool bDescending = false );
+	// Copy the items of this list that match a predicate, e.g. "score >= 100 && team == 'red'".
+	FJsonLibraryList FilterByPredicate( const FString& Predicate ) const;
+	// Group the items of this list by a property, e.g. "team.name".
+	// Group keys are prefixed with the type of the value, e.g. "n1" or "s1".
+	FJsonLibraryObject GroupBy( const FString& Key ) const;
+	// Copy the unique items of this list.
+	FJsonLibraryList Distinct() const;
+	// Copy a property from each item in this list, e.g. "team.name".
+	FJsonLibraryList Pluck( const FString& Key ) const;
+
+	// Get the sum of the numbers in this list.
+	double Sum( const FString& Key = FString() ) const;
+	// Get the minimum of the numbers in this list.
+	double Min( const FString& Key = FString() ) const;
+	// Get the maximum of the numbers in this list.
+	double Max( const FString& Key = FString() ) const;
+	// Get the average of the numbers in this list.
+	double Average( const FString& Key = FString() ) const;
+
 protected:
 	
 	TSharedPtr<FJsonValueArray> JsonArray;
@@ -386,6 +411,8 @@ private:
 	void NotifyParse();
 	void NotifyRemove( int32 Index );
 
+	bool Aggregate( const FString& Key, double& OutSum, double& OutMin, double& OutMax, int32& OutCount ) const;
+
 public:
 
 	// Check if this list is valid.
@@ -404,6 +431,9 @@ public:
 	// Stringify this list as a JSON string.
 	FString Stringify( bool bCondensed = true ) const;
 
+	// Copy this list to an immutable value that can be shared between threads.
+	FJsonLibraryFrozenValue Freeze() const;
+
 	// Copy this list to an array of JSON values.
 	TArray<FJsonLibraryValue> ToArray() const;
 
@@ -438,6 +468,16 @@ public:
 	// Copy this list to an array of JSON objects.
 	TArray<FJsonLibraryObject> ToObjectArray() const;
 
+	// Copy the properties of the objects in this list to columns of typed arrays.
+	bool ToColumns( const FJsonLibraryColumns& Columns ) const;
+	// Copy columns of typed arrays to a list of objects.
+	static FJsonLibraryList FromColumns( const FJsonLibraryColumns& Columns );
+
+	// Copy the objects in this list to the rows of a data table.
+	bool ToDataTable( UDataTable* DataTable, const FString& RowNameKey = TEXT( "Name" ) ) const;
+	// Copy the rows of a data table to a list of objects.
+	static FJsonLibraryList FromDataTable( const UDataTable* DataTable, const FString& RowNameKey = TEXT( "Name" ) );
+
 	bool operator==( const FJsonLibraryList& List ) const;
 	bool operator!=( const FJsonLibraryList& List ) const;
 
@@ -11,6 +11,7 @@
 #include "JsonLibraryObject.generated.h"
 
 typedef struct FJsonLibraryList FJsonLibraryList;
+typedef struct FJsonLibraryFrozenValue FJsonLibraryFrozenValue;
 
 DECLARE_DYNAMIC_DELEGATE_FourParams( FJsonLibraryObjectNotify, const FJsonLibraryValue&, Object, EJsonLibraryNotifyAction, Action, const FString&, Key, const FJsonLibraryValue&, Value );
 
@@ -82,6 +83,13 @@ public:
 	
 	// Add a JSON object to this object.
 	void Add( const FJsonLibraryObject& Object );
+	// Deep merge a JSON object into this object, merging nested objects in place.
+	// Merging by key matches list items on a property, or on their index if the key is empty.
+	void DeepMerge( const FJsonLibraryObject& Object, EJsonLibraryArrayMerge Arrays = EJsonLibraryArrayMerge::Replace, const FString& ArrayKey = FString() );
+	// Apply a JSON merge patch (RFC 7396) to this object.
+	void MergePatch( const FJsonLibraryObject& Patch );
+	// Create a JSON merge patch (RFC 7396) that turns this object into another.
+	FJsonLibraryObject CreateMergePatch( const FJsonLibraryObject& Object ) const;
 
 	// Add a map of booleans to this object.
 	void AddBooleanMap( const TMap<FString, bool>& Map );
@@ -219,6 +227,7 @@ private:
 	void NotifyClear();
 	void NotifyParse();
 	void NotifyRemove( const FString& Key );
+	void NotifyMerge( EJsonLibraryNotifyAction Action, const FString& Key, const TSharedPtr<FJsonValue>& Value );
 
 public:
 
@@ -248,6 +257,9 @@ public:
 	// Stringify this object as a JSON string.
 	FString Stringify( bool bCondensed = true ) const;
 
+	// Copy this object to an immutable value that can be shared between threads.
+	FJsonLibraryFrozenValue Freeze() const;
+
 protected:
 	
 	bool ToStruct( const UStruct* StructType, void* StructPtr ) const;
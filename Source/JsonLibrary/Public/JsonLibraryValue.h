@@ -10,12 +10,14 @@
 
 typedef struct FJsonLibraryObject FJsonLibraryObject;
 typedef struct FJsonLibraryList FJsonLibraryList;
+typedef struct FJsonLibraryFrozenValue FJsonLibraryFrozenValue;
 
 USTRUCT(BlueprintType, meta = (DisplayName = "JSON Value"))
 struct JSONLIBRARY_API FJsonLibraryValue
 {
 	friend struct FJsonLibraryList;
 	friend struct FJsonLibraryObject;
+	friend struct FJsonLibraryFrozenValue;
 
 	GENERATED_USTRUCT_BODY()
 
@@ -143,12 +145,21 @@ public:
 
 	// Parse a JSON string.
 	static FJsonLibraryValue Parse( const FString& Text );
+	// Parse a large JSON string, only parsing objects and lists when they are accessed.
+	static FJsonLibraryValue ParseLazy( const FString& Text );
+	// Parse a large JSON string without copying it, the values keep the text until they are accessed.
+	static FJsonLibraryValue ParseLazy( FString&& Text );
 	// Parse a relaxed JSON string.
 	static FJsonLibraryValue ParseRelaxed( const FString& Text, bool bStripComments = true, bool bStripTrailingCommas = true );
 
 	// Stringify this value as a JSON string.
 	FString Stringify( bool bCondensed = true ) const;
 
+	// Copy this value to an immutable value that can be shared between threads.
+	FJsonLibraryFrozenValue Freeze() const;
+	// Copy this value, including any objects and arrays it holds.
+	FJsonLibraryValue Copy() const;
+
 	// Copy this value to an array of JSON values.
 	TArray<FJsonLibraryValue> ToArray() const;
 	// Copy this value to a map of JSON values.
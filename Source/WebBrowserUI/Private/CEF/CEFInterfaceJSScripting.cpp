@@ -5,17 +5,131 @@
 
 #include "WebInterfaceJSScripting.h"
 #include "WebInterfaceJSFunction.h"
+#include "WebInterfaceJSDispatcher.h"
+#include "WebInterfaceJSProfiler.h"
+#include "WebInterfaceBrowserLog.h"
+#include "WebInterfaceBrowserModule.h"
+#include "IWebInterfaceBrowserSingleton.h"
 #include "CEFWebInterfaceBrowserWindow.h"
 #include "CEFInterfaceJSStructSerializerBackend.h"
 #include "CEFInterfaceJSStructDeserializerBackend.h"
 #include "StructSerializer.h"
 #include "StructDeserializer.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/GarbageCollection.h"
+#include "Async/Async.h"
 
 
 // Internal utility function(s)
 namespace
 {
 
+	template<typename ContainerType, typename KeyType>
+	uint32 HashContainerValue(ContainerType Container, KeyType Key);
+
+	uint32 HashCefList(CefRefPtr<CefListValue> List)
+	{
+		uint32 Hash = GetTypeHash((int32)List->GetSize());
+		for (size_t Index = 0; Index < List->GetSize(); ++Index)
+		{
+			Hash = HashCombine(Hash, HashContainerValue(List, Index));
+		}
+		return Hash;
+	}
+
+	uint32 HashCefDictionary(CefRefPtr<CefDictionaryValue> Dictionary)
+	{
+		CefDictionaryValue::KeyList Keys;
+		Dictionary->GetKeys(Keys);
+
+		uint32 Hash = GetTypeHash((int32)Keys.size());
+		for (const CefString& Key : Keys)
+		{
+			Hash = HashCombine(Hash, FCrc::MemCrc32(Key.c_str(), Key.length() * sizeof(*Key.c_str())));
+			Hash = HashCombine(Hash, HashContainerValue(Dictionary, Key));
+		}
+		return Hash;
+	}
+
+	// Only has to agree for equal values, IsEqual decides whether they are
+	template<typename ContainerType, typename KeyType>
+	uint32 HashContainerValue(ContainerType Container, KeyType Key)
+	{
+		switch (Container->GetType(Key))
+		{
+			case VTYPE_BOOL:
+				return Container->GetBool(Key) ? 1 : 0;
+			case VTYPE_INT:
+				return GetTypeHash(Container->GetInt(Key));
+			case VTYPE_DOUBLE:
+				return GetTypeHash(Container->GetDouble(Key));
+			case VTYPE_STRING:
+			{
+				const CefString String = Container->GetString(Key);
+				return FCrc::MemCrc32(String.c_str(), String.length() * sizeof(*String.c_str()));
+			}
+			case VTYPE_BINARY:
+				return GetTypeHash((int32)Container->GetBinary(Key)->GetSize());
+			case VTYPE_DICTIONARY:
+				return HashCefDictionary(Container->GetDictionary(Key));
+			case VTYPE_LIST:
+				return HashCefList(Container->GetList(Key));
+			default:
+				return Container->GetType(Key);
+		}
+	}
+
+	template<typename ContainerType, typename KeyType>
+	int32 SizeContainerValue(ContainerType Container, KeyType Key);
+
+	// Roughly the size of the values as JSON, for the profiler
+	int32 SizeCefList(CefRefPtr<CefListValue> List)
+	{
+		int32 Size = 2;
+		for (size_t Index = 0; Index < List->GetSize(); ++Index)
+		{
+			Size += SizeContainerValue(List, Index) + 1;
+		}
+		return Size;
+	}
+
+	int32 SizeCefDictionary(CefRefPtr<CefDictionaryValue> Dictionary)
+	{
+		CefDictionaryValue::KeyList Keys;
+		Dictionary->GetKeys(Keys);
+
+		int32 Size = 2;
+		for (const CefString& Key : Keys)
+		{
+			Size += (int32)Key.length() + 4 + SizeContainerValue(Dictionary, Key);
+		}
+		return Size;
+	}
+
+	template<typename ContainerType, typename KeyType>
+	int32 SizeContainerValue(ContainerType Container, KeyType Key)
+	{
+		switch (Container->GetType(Key))
+		{
+			case VTYPE_BOOL:
+				return 5;
+			case VTYPE_INT:
+			case VTYPE_DOUBLE:
+				return 8;
+			case VTYPE_STRING:
+				return (int32)Container->GetString(Key).length() + 2;
+			case VTYPE_BINARY:
+				return (int32)Container->GetBinary(Key)->GetSize();
+			case VTYPE_DICTIONARY:
+				return SizeCefDictionary(Container->GetDictionary(Key));
+			case VTYPE_LIST:
+				return SizeCefList(Container->GetList(Key));
+			default:
+				return 4;
+		}
+	}
+
 	template<typename DestContainerType, typename SrcContainerType, typename DestKeyType, typename SrcKeyType>
 	bool CopyContainerValue(DestContainerType DestContainer, SrcContainerType SrcContainer, DestKeyType DestKey, SrcKeyType SrcKey )
 	{
@@ -43,6 +157,67 @@ namespace
 		}
 
 	}
+
+	typedef FWebInterfaceJSParam::FTypedArray (*FTypedArrayMaker)(const void* Array);
+
+	template<typename ElementType>
+	FWebInterfaceJSParam::FTypedArray MakeTypedArray(const void* Array)
+	{
+		return FWebInterfaceJSParam::FTypedArray(*static_cast<const TArray<ElementType>*>(Array));
+	}
+
+	// Numeric arrays that have a typed array to go in, null for anything else
+#if UE_VERSION >= 425
+	FTypedArrayMaker FindTypedArray(const FProperty* Property)
+	{
+		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+		const FProperty* Inner = ArrayProperty ? ArrayProperty->Inner : nullptr;
+		const FByteProperty* ByteProperty = CastField<FByteProperty>(Inner);
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Inner);
+
+		if (Inner == nullptr || Property->ArrayDim != 1)
+		{
+			return nullptr;
+		}
+		if (Inner->IsA<FFloatProperty>())
+		{
+			return &MakeTypedArray<float>;
+		}
+		if (Inner->IsA<FIntProperty>())
+		{
+			return &MakeTypedArray<int32>;
+		}
+#else
+	FTypedArrayMaker FindTypedArray(const UProperty* Property)
+	{
+		const UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property);
+		const UProperty* Inner = ArrayProperty ? ArrayProperty->Inner : nullptr;
+		const UByteProperty* ByteProperty = Cast<UByteProperty>(Inner);
+		const UStructProperty* StructProperty = Cast<UStructProperty>(Inner);
+
+		if (Inner == nullptr || Property->ArrayDim != 1)
+		{
+			return nullptr;
+		}
+		if (Inner->IsA<UFloatProperty>())
+		{
+			return &MakeTypedArray<float>;
+		}
+		if (Inner->IsA<UIntProperty>())
+		{
+			return &MakeTypedArray<int32>;
+		}
+#endif
+		if (ByteProperty && ByteProperty->Enum == nullptr)
+		{
+			return &MakeTypedArray<uint8>;
+		}
+		if (StructProperty && StructProperty->Struct == TBaseStructure<FVector>::Get())
+		{
+			return &MakeTypedArray<FVector>;
+		}
+		return nullptr;
+	}
 }
 
 CefRefPtr<CefDictionaryValue> FCEFInterfaceJSScripting::ConvertStruct(UStruct* TypeInfo, const void* StructPtr)
@@ -60,23 +235,43 @@ CefRefPtr<CefDictionaryValue> FCEFInterfaceJSScripting::ConvertStruct(UStruct* T
 CefRefPtr<CefDictionaryValue> FCEFInterfaceJSScripting::ConvertObject(UObject* Object)
 {
 	CefRefPtr<CefDictionaryValue> Result = CefDictionaryValue::Create();
-	RetainBinding(Object);
+	const int32 Slot = RetainBinding(Object);
 
 	UClass* Class = Object->GetClass();
-	CefRefPtr<CefListValue> MethodNames = CefListValue::Create();
-	int32 MethodIndex = 0;
-	for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::IncludeSuper); FunctionIt; ++FunctionIt)
+	CefRefPtr<CefListValue>* MethodNames = ClassMethods.Find(Class);
+	if (MethodNames == nullptr)
 	{
-		UFunction* Function = *FunctionIt;
-		MethodNames->SetString(MethodIndex++, TCHAR_TO_WCHAR(*GetBindingName(Function)));
+		CefRefPtr<CefListValue> NewMethodNames = CefListValue::Create();
+		int32 MethodIndex = 0;
+		for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::IncludeSuper); FunctionIt; ++FunctionIt)
+		{
+			UFunction* Function = *FunctionIt;
+			NewMethodNames->SetString(MethodIndex++, TCHAR_TO_WCHAR(*GetBindingName(Function)));
+		}
+		MethodNames = &ClassMethods.Add(Class, NewMethodNames);
 	}
 
 	Result->SetString("$type", "uobject");
-	Result->SetString("$id", TCHAR_TO_WCHAR(*PtrToGuid(Object).ToString(EGuidFormats::Digits)));
-	Result->SetList("$methods", MethodNames);
+	Result->SetString("$id", TCHAR_TO_WCHAR(*GetObjectId(Slot)));
+	// The cached list has to stay unowned, so each object gets its own copy
+	Result->SetList("$methods", (*MethodNames)->Copy());
 	return Result;
 }
 
+FCEFInterfaceJSScripting::~FCEFInterfaceJSScripting()
+{
+	if (ObservedHandle.IsValid() && IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable())
+	{
+		IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().Remove(ObservedHandle);
+	}
+}
+
+void FCEFInterfaceJSScripting::FlushClassCaches()
+{
+	ClassMethods.Empty();
+	InvocationPlans.Empty();
+}
+
 
 bool FCEFInterfaceJSScripting::OnProcessMessageReceived(CefRefPtr<CefBrowser> Browser, CefProcessId SourceProcess, CefRefPtr<CefProcessMessage> Message)
 {
@@ -131,7 +326,7 @@ void FCEFInterfaceJSScripting::BindUObject(const FString& Name, UObject* Object,
 		{
 			return;
 		}
-		BoundObjects[Object]={true, -1};
+		MakeBindingPermanent(Object);
 		PermanentUObjectsByName.Add(ExposedName, Object);
 	}
 
@@ -144,6 +339,14 @@ void FCEFInterfaceJSScripting::BindUObject(const FString& Name, UObject* Object,
 
 	MessageArguments->SetDictionary(0, Value);
 	SendProcessMessage(SetValueMessage);
+
+	// Bindings made after the dispatcher attached need their methods wrapped as well, the script arrives after the value
+	CefRefPtr<CefFrame> Frame = IsValid() ? InternalCefBrowser->GetMainFrame() : nullptr;
+	if (bIsPermanent && Frame && Dispatcher && Dispatcher->IsAttached())
+	{
+		const FString Script = FString::Printf(TEXT("typeof ue != 'undefined' && typeof ue['$typedarray'] != 'undefined' && ue['$typedarray'].wrap('%s');"), *ExposedName);
+		Frame->ExecuteJavaScript(TCHAR_TO_UTF8(*Script), Frame->GetURL(), 0);
+	}
 }
 
 void FCEFInterfaceJSScripting::UnbindUObject(const FString& Name, UObject* Object, bool bIsPermanent)
@@ -156,7 +359,7 @@ void FCEFInterfaceJSScripting::UnbindUObject(const FString& Name, UObject* Objec
 		if (PermanentUObjectsByName.Contains(ExposedName) && (Object == nullptr || PermanentUObjectsByName[ExposedName] == Object))
 		{
 			Object = PermanentUObjectsByName.FindAndRemoveChecked(ExposedName);
-			BoundObjects.Remove(Object);
+			RemoveBinding(Object);
 			return;
 		}
 		else
@@ -165,11 +368,19 @@ void FCEFInterfaceJSScripting::UnbindUObject(const FString& Name, UObject* Objec
 		}
 	}
 
+	// The renderer deletes the value by its id, an object that isn't bound has nothing to delete
+	const ObjectBinding* Binding = Object ? BoundObjects.Find(Object) : nullptr;
+	if (Binding == nullptr)
+	{
+		return;
+	}
+	const FGuid ObjectId = SlotToGuid(Binding->Slot, ObjectSlots[Binding->Slot].Generation);
+
 	CefRefPtr<CefProcessMessage> DeleteValueMessage = CefProcessMessage::Create(TCHAR_TO_WCHAR(TEXT("UE::DeleteValue")));
 	CefRefPtr<CefListValue>MessageArguments = DeleteValueMessage->GetArgumentList();
 	CefRefPtr<CefDictionaryValue> Info = CefDictionaryValue::Create();
 	Info->SetString("name", TCHAR_TO_WCHAR(*ExposedName));
-	Info->SetString("id", TCHAR_TO_WCHAR(*PtrToGuid(Object).ToString(EGuidFormats::Digits)));
+	Info->SetString("id", TCHAR_TO_WCHAR(*ObjectId.ToString(EGuidFormats::Digits)));
 	Info->SetBool("permanent", bIsPermanent);
 
 	MessageArguments->SetDictionary(0, Info);
@@ -186,7 +397,7 @@ bool FCEFInterfaceJSScripting::HandleReleaseUObjectMessage(CefRefPtr<CefListValu
 		return false;
 	}
 
-	if (!FGuid::Parse(FString(WCHAR_TO_TCHAR(MessageArguments->GetString(0).ToWString().c_str())), ObjectKey))
+	if (!ParseId(FString(WCHAR_TO_TCHAR(MessageArguments->GetString(0).ToWString().c_str())), ObjectKey))
 	{
 		// Invalid GUID
 		return false;
@@ -217,7 +428,7 @@ bool FCEFInterfaceJSScripting::HandleExecuteUObjectMethodMessage(CefRefPtr<CefLi
 		return false;
 	}
 
-	if (!FGuid::Parse(FString(WCHAR_TO_TCHAR(MessageArguments->GetString(0).ToWString().c_str())), ObjectKey))
+	if (!ParseId(FString(WCHAR_TO_TCHAR(MessageArguments->GetString(0).ToWString().c_str())), ObjectKey))
 	{
 		// Invalid GUID
 		return false;
@@ -225,7 +436,7 @@ bool FCEFInterfaceJSScripting::HandleExecuteUObjectMethodMessage(CefRefPtr<CefLi
 
 	// Get the promise callback and use that to report any results from executing this function.
 	FGuid ResultCallbackId;
-	if (!FGuid::Parse(FString(WCHAR_TO_TCHAR(MessageArguments->GetString(2).ToWString().c_str())), ResultCallbackId))
+	if (!ParseId(FString(WCHAR_TO_TCHAR(MessageArguments->GetString(2).ToWString().c_str())), ResultCallbackId))
 	{
 		// Invalid GUID
 		return false;
@@ -240,146 +451,935 @@ bool FCEFInterfaceJSScripting::HandleExecuteUObjectMethodMessage(CefRefPtr<CefLi
 	}
 
 	FName MethodName = WCHAR_TO_TCHAR(MessageArguments->GetString(1).ToWString().c_str());
-	UFunction* Function = Object->FindFunction(MethodName);
-	if (!Function)
+	if (Object == Dispatcher && MethodName == FName(TEXT("Batch")))
 	{
-		InvokeJSErrorResult(ResultCallbackId, TEXT("Unknown UObject Function"));
+		ProfileCall(ResultCallbackId, TEXT("$batch"));
+		return HandleBatchMessage(MessageArguments->GetList(3), ResultCallbackId);
+	}
+
+	if (FWebInterfaceJSProfiler::IsEnabled())
+	{
+		TSharedPtr<FInvocationPlan> Plan = GetInvocationPlan(Object, MethodName);
+		if (Plan.IsValid())
+		{
+			ProfileCall(ResultCallbackId, Plan->ProfileName);
+		}
+	}
+
+	if (IsAsyncMethod(Object, MethodName))
+	{
+		// Kept results of the object may not hold once it returns
+		InvalidateUObject(Object);
+		InvokeUObjectMethodAsync(Object, MethodName, MessageArguments->GetList(3), ResultCallbackId);
 		return true;
 	}
-	// Coerce arguments to function arguments.
-	uint16 ParamsSize = Function->ParmsSize;
-	uint8* Params  = nullptr;
 
-#if UE_VERSION >= 425
-	FProperty* ReturnParam = nullptr;
-	FProperty* PromiseParam = nullptr;
-#else
-	UProperty* ReturnParam = nullptr;
-	UProperty* PromiseParam = nullptr;
-#endif
+	CefRefPtr<CefListValue> Results = CefListValue::Create();
+	switch (InvokeUObjectMethod(Object, MethodName, MessageArguments->GetList(3), ResultCallbackId, true, Results))
+	{
+		case EMethodResult::Completed:
+			InvokeJSFunction(ResultCallbackId, Results, false);
+			break;
+		case EMethodResult::Failed:
+			InvokeJSFunction(ResultCallbackId, Results, true);
+			break;
+		default:
+			// If the method takes a FWebInterfaceJSResponse, we assume that the UFunction will ensure it is called with the result
+			break;
+	}
+
+	return true;
+}
 
-	if (ParamsSize > 0)
+bool FCEFInterfaceJSScripting::HandleBatchMessage(CefRefPtr<CefListValue> BatchArguments, const FGuid& ResultCallbackId)
+{
+	// Arguments are a single list of [object, method, arguments] calls
+	if (BatchArguments->GetSize() != 1 || BatchArguments->GetType(0) != VTYPE_LIST)
 	{
-		// Convert cef argument list to a dictionary, so we can use FStructDeserializer to convert it for us
-		CefRefPtr<CefDictionaryValue> NamedArgs = CefDictionaryValue::Create();
-		int32 CurrentArg = 0;
-		CefRefPtr<CefListValue> CefArgs = MessageArguments->GetList(3);
-#if UE_VERSION >= 425
-		for ( TFieldIterator<FProperty> It(Function); It; ++It )
-#else
-		for ( TFieldIterator<UProperty> It(Function); It; ++It )
-#endif
+		InvokeJSErrorResult(ResultCallbackId, TEXT("Invalid batch"));
+		return true;
+	}
+
+	CefRefPtr<CefListValue> Calls = BatchArguments->GetList(0);
+	CefRefPtr<CefListValue> Replies = CefListValue::Create();
+	Replies->SetSize(Calls->GetSize());
+
+	// Every call gets a [status, value] reply, so all results go back in a single message
+	for (size_t CallIndex = 0; CallIndex < Calls->GetSize(); ++CallIndex)
+	{
+		CefRefPtr<CefListValue> Reply = CefListValue::Create();
+		CefRefPtr<CefListValue> Results = CefListValue::Create();
+		EMethodResult Result = EMethodResult::Failed;
+
+		CefRefPtr<CefListValue> Call;
+		if (Calls->GetType(CallIndex) == VTYPE_LIST)
 		{
-#if UE_VERSION >= 425
-			FProperty* Param = *It;
-#else
-			UProperty* Param = *It;
-#endif
+			Call = Calls->GetList(CallIndex);
+		}
+
+		FGuid ObjectKey;
+		if (!Call.get() || Call->GetSize() < 3 || Call->GetType(0) != VTYPE_DICTIONARY || Call->GetType(1) != VTYPE_STRING || Call->GetType(2) != VTYPE_LIST
+			|| !ParseId(FString(WCHAR_TO_TCHAR(Call->GetDictionary(0)->GetString("$id").ToWString().c_str())), ObjectKey))
+		{
+			Results->SetString(0, TCHAR_TO_WCHAR(TEXT("Invalid call")));
+		}
+		else if (UObject* Object = GuidToPtr(ObjectKey))
+		{
+			Result = InvokeUObjectMethod(Object, WCHAR_TO_TCHAR(Call->GetString(1).ToWString().c_str()), Call->GetList(2), FGuid(), false, Results);
+		}
+		else
+		{
+			Results->SetString(0, TCHAR_TO_WCHAR(TEXT("Unknown UObject ID")));
+		}
+
+		Reply->SetInt(0, (int32)Result);
+		if (Results->GetSize() > 0)
+		{
+			CopyContainerValue(Reply, Results, 1, 0);
+		}
+		Replies->SetList(CallIndex, Reply);
+	}
+
+	CefRefPtr<CefListValue> Results = CefListValue::Create();
+	Results->SetList(0, Replies);
+	InvokeJSFunction(ResultCallbackId, Results, false);
+	return true;
+}
+
+FCEFInterfaceJSScripting::EMethodResult FCEFInterfaceJSScripting::InvokeUObjectMethod(UObject* Object, const FName& MethodName, CefRefPtr<CefListValue> CefArgs, const FGuid& ResultCallbackId, bool bAllowResponse, CefRefPtr<CefListValue>& Results)
+{
+	TSharedPtr<FInvocationPlan> Plan = GetInvocationPlan(Object, MethodName);
+	if (!Plan.IsValid())
+	{
+		Results->SetString(0, TCHAR_TO_WCHAR(TEXT("Unknown UObject Function")));
+		return EMethodResult::Failed;
+	}
+
+	if (Plan->PromiseParam && !bAllowResponse)
+	{
+		return EMethodResult::NotBatchable;
+	}
+
+	if (FWebInterfaceJSProfiler::IsEnabled())
+	{
+		FWebInterfaceJSProfiler::AddCall(Plan->ProfileName, SizeCefList(CefArgs));
+	}
+
+	FMemoizedObject* Memoized = MemoizedObjects.Find(Object);
+	bool bMemoize = false;
+	uint32 ArgumentHash = 0;
+
+	if (Memoized)
+	{
+		if (Memoized->Frame != GFrameCounter)
+		{
+			Memoized->Frame = GFrameCounter;
+			Memoized->Methods.Reset();
+		}
+
+		if (!Plan->bMemoizable)
+		{
+			// Anything the object returns may have changed
+			Memoized->Methods.Reset();
+		}
+		else
+		{
+			bMemoize = true;
+			ArgumentHash = HashCefList(CefArgs);
 
-			if (Param->PropertyFlags & CPF_Parm)
+			if (const TArray<FMemoizedResult>* MemoizedResults = Memoized->Methods.Find(MethodName))
 			{
-				if (Param->PropertyFlags & CPF_ReturnParm)
-				{
-					ReturnParam = Param;
-				}
-				else
+				for (const FMemoizedResult& Entry : *MemoizedResults)
 				{
-#if UE_VERSION >= 425
-					FStructProperty *StructProperty = CastField<FStructProperty>(Param);
-#else
-					UStructProperty *StructProperty = Cast<UStructProperty>(Param);
-#endif
-
-					if (StructProperty && StructProperty->Struct->IsChildOf(FWebInterfaceJSResponse::StaticStruct()))
-					{
-						PromiseParam = Param;
-					}
-					else
+					if (Entry.Hash == ArgumentHash && Entry.Arguments->IsEqual(CefArgs))
 					{
-						CopyContainerValue(NamedArgs, CefArgs, CefString(TCHAR_TO_WCHAR(*GetBindingName(Param))), CurrentArg);
-						CurrentArg++;
+						Results = Entry.Results->Copy();
+						return EMethodResult::Completed;
 					}
 				}
 			}
 		}
+	}
+
+	uint8* Params = nullptr;
+	{
+		WEBUI_BRIDGE_SCOPE(Decode, Plan->ProfileName);
+		Params = ReadArguments(*Plan, CefArgs, ResultCallbackId);
+	}
+	{
+		WEBUI_BRIDGE_SCOPE(Process, Plan->ProfileName);
+		Object->ProcessEvent(Plan->Function.Get(), Params);
+	}
+	EMethodResult Result = EMethodResult::Pending;
+
+	if ( ! Plan->PromiseParam ) // If PromiseParam is set, we assume that the UFunction will ensure it is called with the result
+	{
+		Result = EMethodResult::Completed;
+		{
+			WEBUI_BRIDGE_SCOPE(Encode, Plan->ProfileName);
+			WriteReturnValue(Object, *Plan, Params, Results);
+		}
+
+		// The method may have changed what is kept, so look it up again
+		Memoized = bMemoize ? MemoizedObjects.Find(Object) : nullptr;
+		if (Memoized && Memoized->Frame == GFrameCounter)
+		{
+			// Keep a bounded number of argument sets for each method
+			TArray<FMemoizedResult>& MemoizedResults = Memoized->Methods.FindOrAdd(MethodName);
+			if (MemoizedResults.Num() < 64)
+			{
+				MemoizedResults.Add({ ArgumentHash, CefArgs->Copy(), Results->Copy() });
+			}
+		}
+	}
+
+	if (Params)
+	{
+		ReleaseFrame(*Plan, Params);
+		Params = nullptr;
+	}
+
+	return Result;
+}
+
+uint8* FCEFInterfaceJSScripting::ReadArguments(FInvocationPlan& Plan, CefRefPtr<CefListValue> CefArgs, const FGuid& ResultCallbackId)
+{
+	UFunction* Function = Plan.Function.Get();
+	if (Function->ParmsSize <= 0)
+	{
+		return nullptr;
+	}
+
+	uint8* Params = AllocateFrame(Plan);
+
+	// Simple arguments are read straight from the list, the rest go through FStructDeserializer
+	CefRefPtr<CefDictionaryValue> NamedArgs;
+	if (Plan.bDeserialize)
+	{
+		NamedArgs = CefDictionaryValue::Create();
+	}
+	const int32 ArgCount = FMath::Min(Plan.Arguments.Num(), (int32)CefArgs->GetSize());
+	for (int32 ArgIndex = 0; ArgIndex < ArgCount; ArgIndex++)
+	{
+		const FInvocationArgument& Argument = Plan.Arguments[ArgIndex];
+		if (Argument.bDirect)
+		{
+			FCEFInterfaceJSStructDeserializerBackend::ReadArgument(SharedThis(this), Argument.Property, Params, CefArgs, ArgIndex);
+		}
+		else
+		{
+			CopyContainerValue(NamedArgs, CefArgs, Argument.Name, ArgIndex);
+		}
+	}
 
+	if (NamedArgs.get() && NamedArgs->GetSize() > 0)
+	{
 		// UFunction is a subclass of UStruct, so we can treat the arguments as a struct for deserialization
-		check(nullptr == Params);
-		Params = (uint8*)FMemory::Malloc(Function->GetStructureSize());
-		Function->InitializeStruct(Params);
 		FCEFInterfaceJSStructDeserializerBackend Backend = FCEFInterfaceJSStructDeserializerBackend(SharedThis(this), NamedArgs);
 		FStructDeserializer::Deserialize(Params, *Function, Backend);
 	}
 
-	if (PromiseParam)
+	if (Plan.PromiseParam)
 	{
-		FWebInterfaceJSResponse* PromisePtr = PromiseParam->ContainerPtrToValuePtr<FWebInterfaceJSResponse>(Params);
+		FWebInterfaceJSResponse* PromisePtr = Plan.PromiseParam->ContainerPtrToValuePtr<FWebInterfaceJSResponse>(Params);
 		if (PromisePtr)
 		{
 			*PromisePtr = FWebInterfaceJSResponse(SharedThis(this), ResultCallbackId);
 		}
 	}
 
-	Object->ProcessEvent(Function, Params);
-	CefRefPtr<CefListValue> Results = CefListValue::Create();
+	return Params;
+}
 
-	if ( ! PromiseParam ) // If PromiseParam is set, we assume that the UFunction will ensure it is called with the result
-	{
-		if ( ReturnParam )
-		{
-			FStructSerializerPolicies ReturnPolicies;
+void FCEFInterfaceJSScripting::WriteReturnValue(UObject* Object, FInvocationPlan& Plan, uint8* Params, CefRefPtr<CefListValue>& Results)
+{
 #if UE_VERSION >= 425
-			ReturnPolicies.PropertyFilter = [&](const FProperty* CandidateProperty, const FProperty* ParentProperty)
+	FProperty* ReturnParam = Plan.ReturnParam;
 #else
-			ReturnPolicies.PropertyFilter = [&](const UProperty* CandidateProperty, const UProperty* ParentProperty)
+	UProperty* ReturnParam = Plan.ReturnParam;
 #endif
-			{
-				return ParentProperty != nullptr || CandidateProperty == ReturnParam;
-			};
-			FCEFInterfaceJSStructSerializerBackend ReturnBackend(SharedThis(this));
-			FStructSerializer::Serialize(Params, *Function, ReturnBackend, ReturnPolicies);
-			CefRefPtr<CefDictionaryValue> ResultDict = ReturnBackend.GetResult();
 
-			// Extract the single return value from the serialized dictionary to an array
-			CopyContainerValue(Results, ResultDict, 0, TCHAR_TO_WCHAR(*GetBindingName(ReturnParam)));
-		}
-		InvokeJSFunction(ResultCallbackId, Results, false);
+	if (ReturnParam == nullptr)
+	{
+		return;
 	}
 
-	if (Params)
+	// Sent as one string that the page restores, instead of a value per element
+	if (Plan.MakeTypedArray && TypedArrayObjects.Contains(Object))
 	{
-		Function->DestroyStruct(Params);
-		FMemory::Free(Params);
-		Params = nullptr;
+		FWebInterfaceJSParam TypedArray(Plan.MakeTypedArray(ReturnParam->ContainerPtrToValuePtr<void>(Params)));
+		SetConverted(Results, 0, TypedArray);
+		return;
 	}
 
-	return true;
-}
+	FStructSerializerPolicies ReturnPolicies;
+#if UE_VERSION >= 425
+	ReturnPolicies.PropertyFilter = [&](const FProperty* CandidateProperty, const FProperty* ParentProperty)
+#else
+	ReturnPolicies.PropertyFilter = [&](const UProperty* CandidateProperty, const UProperty* ParentProperty)
+#endif
+	{
+		return ParentProperty != nullptr || CandidateProperty == ReturnParam;
+	};
+	FCEFInterfaceJSStructSerializerBackend ReturnBackend(SharedThis(this));
+	FStructSerializer::Serialize(Params, *Plan.Function.Get(), ReturnBackend, ReturnPolicies);
+	CefRefPtr<CefDictionaryValue> ResultDict = ReturnBackend.GetResult();
 
-void FCEFInterfaceJSScripting::UnbindCefBrowser()
-{
-	InternalCefBrowser = nullptr;
+	// Extract the single return value from the serialized dictionary to an array
+	CopyContainerValue(Results, ResultDict, 0, TCHAR_TO_WCHAR(*GetBindingName(ReturnParam)));
 }
 
-void FCEFInterfaceJSScripting::InvokeJSErrorResult(FGuid FunctionId, const FString& Error)
+void FCEFInterfaceJSScripting::InvokeUObjectMethodAsync(UObject* Object, const FName& MethodName, CefRefPtr<CefListValue> CefArgs, const FGuid& ResultCallbackId)
 {
-	CefRefPtr<CefListValue> FunctionArguments = CefListValue::Create();
-	FunctionArguments->SetString(0, TCHAR_TO_WCHAR(*Error));
-	InvokeJSFunction(FunctionId, FunctionArguments, true);
-}
+	TSharedPtr<FInvocationPlan> Plan = GetInvocationPlan(Object, MethodName);
+	if (!Plan.IsValid())
+	{
+		InvokeJSErrorResult(ResultCallbackId, TEXT("Unknown UObject Function"));
+		return;
+	}
 
-void FCEFInterfaceJSScripting::InvokeJSFunction(FGuid FunctionId, int32 ArgCount, FWebInterfaceJSParam Arguments[], bool bIsError)
-{
-	CefRefPtr<CefListValue> FunctionArguments = CefListValue::Create();
-	for ( int32 i=0; i<ArgCount; i++)
+	if (FWebInterfaceJSProfiler::IsEnabled())
 	{
-		SetConverted(FunctionArguments, i, Arguments[i]);
+		FWebInterfaceJSProfiler::AddCall(Plan->ProfileName, SizeCefList(CefArgs));
+	}
+
+	// Reading arguments looks up bound objects and registers callbacks, so it stays on the game thread
+	uint8* Params = nullptr;
+	{
+		WEBUI_BRIDGE_SCOPE(Decode, Plan->ProfileName);
+		Params = ReadArguments(*Plan, CefArgs, ResultCallbackId);
+	}
+	AsyncObjects.Add(Object);
+
+	// The frame is released after garbage collection had a chance to run
+	if (Params && Plan->AsyncFrames++ == 0)
+	{
+		Plan->AsyncFunction.Reset(Plan->Function.Get());
+	}
+
+	// The response can be resolved from the worker, which only knows its id
+	if (Plan->PromiseParam)
+	{
+		AddWorkerCallback(ResultCallbackId, SharedThis(this));
+	}
+
+	TWeakPtr<FCEFInterfaceJSScripting> WeakThis = SharedThis(this);
+	TWeakObjectPtr<UObject> WeakObject = Object;
+
+	// Shared pointers are only copied on the game thread, the worker moves them along
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, Object, WeakObject, Plan, Params, ResultCallbackId]() mutable
+	{
+		bool bCalled = false;
+		uint64 ProcessCycles = 0;
+		{
+			// Keeps garbage collection from running while the method does, a collection started meanwhile stalls the game thread until it returns
+			FGCScopeGuard GCGuard;
+
+			UObject* Target = WeakObject.Get();
+			UFunction* Function = Plan->Function.Get();
+			if (Target && Function)
+			{
+				// The profiler is only used on the game thread, so the time is passed back
+				SCOPE_CYCLE_COUNTER(STAT_WebUIBridgeProcess);
+				WEBUI_BRIDGE_TRACE_SCOPE(WebUIBridge_Process);
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+
+				Target->ProcessEvent(Function, Params);
+				ProcessCycles = FPlatformTime::Cycles64() - StartCycles;
+				bCalled = true;
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = MoveTemp(WeakThis), Object, Plan = MoveTemp(Plan), Params, ResultCallbackId, bCalled, ProcessCycles]()
+		{
+			TSharedPtr<FCEFInterfaceJSScripting> Scripting = WeakThis.Pin();
+			if (Scripting.IsValid())
+			{
+				Scripting->CompleteUObjectMethodAsync(Object, *Plan, Params, ResultCallbackId, bCalled, ProcessCycles);
+			}
+			else if (Params)
+			{
+				ReleaseAsyncFrame(*Plan, Params);
+			}
+		});
+	});
+}
+
+void FCEFInterfaceJSScripting::CompleteUObjectMethodAsync(UObject* Object, FInvocationPlan& Plan, uint8* Params, const FGuid& ResultCallbackId, bool bCalled, uint64 ProcessCycles)
+{
+	AsyncObjects.RemoveSingleSwap(Object);
+
+	if (bCalled && FWebInterfaceJSProfiler::IsEnabled())
+	{
+		FWebInterfaceJSProfiler::AddTime(Plan.ProfileName, FWebInterfaceJSProfiler::EPhase::Process, ProcessCycles);
+	}
+
+	if (!bCalled)
+	{
+		InvokeJSErrorResult(ResultCallbackId, TEXT("Unknown UObject Function"));
+	}
+	else if (!Plan.PromiseParam) // If PromiseParam is set, the UFunction reports its result through it
+	{
+		CefRefPtr<CefListValue> Results = CefListValue::Create();
+		{
+			WEBUI_BRIDGE_SCOPE(Encode, Plan.ProfileName);
+			WriteReturnValue(Object, Plan, Params, Results);
+		}
+		InvokeJSFunction(ResultCallbackId, Results, false);
+	}
+
+	if (Params)
+	{
+		ReleaseAsyncFrame(Plan, Params);
+	}
+}
+
+bool FCEFInterfaceJSScripting::IsAsyncMethod(UObject* Object, const FName& MethodName) const
+{
+	const TSet<FName>* Methods = AsyncMethods.Find(Object);
+	return Methods != nullptr && Methods->Contains(MethodName);
+}
+
+void FCEFInterfaceJSScripting::SetUObjectAsyncMethods(UObject* Object, const TArray<FName>& Methods)
+{
+	// Forget objects that are gone
+	for (auto It = AsyncMethods.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Only native functions marked thread safe, blueprint functions run on the script VM which is game thread only
+	// Metadata is stripped from cooked builds, so the mark is checked in the editor where the methods are chosen
+	TSet<FName> SafeMethods;
+	for (const FName& Method : Methods)
+	{
+		UFunction* Function = Object ? Object->FindFunction(Method) : nullptr;
+		if (Function == nullptr || !Function->HasAnyFunctionFlags(FUNC_Native))
+		{
+			UE_LOG(LogWebInterfaceBrowser, Warning, TEXT("%s can't run on a worker thread, only native functions can."), *Method.ToString());
+			continue;
+		}
+
+#if WITH_EDITOR
+		if (!Function->HasMetaData(TEXT("BlueprintThreadSafe")) && !Function->GetOwnerClass()->HasMetaData(TEXT("BlueprintThreadSafe")))
+		{
+			UE_LOG(LogWebInterfaceBrowser, Warning, TEXT("%s can't run on a worker thread, it isn't marked BlueprintThreadSafe."), *Method.ToString());
+			continue;
+		}
+#endif
+
+		SafeMethods.Add(Method);
+	}
+
+	if (SafeMethods.Num() > 0)
+	{
+		AsyncMethods.Add(Object, MoveTemp(SafeMethods));
+	}
+	else
+	{
+		AsyncMethods.Remove(Object);
+	}
+}
+
+void FCEFInterfaceJSScripting::SetUObjectMemoized(UObject* Object, bool bMemoize)
+{
+	// Forget objects that are gone
+	for (auto It = MemoizedObjects.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (bMemoize)
+	{
+		MemoizedObjects.FindOrAdd(Object);
+	}
+	else
+	{
+		MemoizedObjects.Remove(Object);
+	}
+}
+
+void FCEFInterfaceJSScripting::SetUObjectTypedArrays(UObject* Object, bool bTypedArrays)
+{
+	// Forget objects that are gone
+	for (auto It = TypedArrayObjects.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (bTypedArrays)
+	{
+		TypedArrayObjects.Add(Object);
+	}
+	else
+	{
+		TypedArrayObjects.Remove(Object);
+	}
+
+	// Kept results were written the other way
+	InvalidateUObject(Object);
+}
+
+void FCEFInterfaceJSScripting::InvalidateUObject(UObject* Object)
+{
+	if (FMemoizedObject* Memoized = MemoizedObjects.Find(Object))
+	{
+		Memoized->Methods.Reset();
+	}
+}
+
+void FCEFInterfaceJSScripting::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	FWebInterfaceJSScripting::AddReferencedObjects(Collector);
+
+	// Objects are kept until the methods running on them return
+	for (auto& Object : AsyncObjects)
+	{
+		Collector.AddReferencedObject(Object);
+	}
+}
+
+TSharedPtr<FCEFInterfaceJSScripting::FInvocationPlan> FCEFInterfaceJSScripting::GetInvocationPlan(UObject* Object, const FName& MethodName)
+{
+	const TPair<UClass*, FName> Key(Object->GetClass(), MethodName);
+	if (TSharedPtr<FInvocationPlan>* Existing = InvocationPlans.Find(Key))
+	{
+		// Functions can be replaced when blueprints are recompiled
+		if ((*Existing)->Function.IsValid())
+		{
+			return *Existing;
+		}
+		InvocationPlans.Remove(Key);
+	}
+
+	UFunction* Function = Object->FindFunction(MethodName);
+	if (!Function)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FInvocationPlan> Plan = MakeShareable(new FInvocationPlan());
+	Plan->Function = Function;
+	Plan->ProfileName = *FString::Printf(TEXT("%s.%s"), *Object->GetClass()->GetName(), *MethodName.ToString());
+
+#if UE_VERSION >= 425
+	for ( TFieldIterator<FProperty> It(Function); It; ++It )
+#else
+	for ( TFieldIterator<UProperty> It(Function); It; ++It )
+#endif
+	{
+#if UE_VERSION >= 425
+		FProperty* Param = *It;
+#else
+		UProperty* Param = *It;
+#endif
+
+		if (!(Param->PropertyFlags & CPF_Parm))
+		{
+			continue;
+		}
+
+		if (Param->PropertyFlags & CPF_ReturnParm)
+		{
+			Plan->ReturnParam = Param;
+			continue;
+		}
+
+#if UE_VERSION >= 425
+		FStructProperty *StructProperty = CastField<FStructProperty>(Param);
+#else
+		UStructProperty *StructProperty = Cast<UStructProperty>(Param);
+#endif
+
+		if (StructProperty && StructProperty->Struct->IsChildOf(FWebInterfaceJSResponse::StaticStruct()))
+		{
+			Plan->PromiseParam = Param;
+			continue;
+		}
+
+		FInvocationArgument Argument;
+		Argument.Property = Param;
+		Argument.Name = TCHAR_TO_WCHAR(*GetBindingName(Param));
+#if UE_VERSION >= 425
+		Argument.bDirect = Param->ArrayDim == 1 && (StructProperty
+			? StructProperty->Struct == FWebInterfaceJSFunction::StaticStruct() || FWebInterfaceJSStructReader::Find(StructProperty->Struct) != nullptr
+			: Param->IsA<FBoolProperty>() || Param->IsA<FNumericProperty>() || Param->IsA<FEnumProperty>()
+				|| Param->IsA<FStrProperty>() || Param->IsA<FNameProperty>() || Param->IsA<FTextProperty>());
+#else
+		Argument.bDirect = Param->ArrayDim == 1 && (StructProperty
+			? StructProperty->Struct == FWebInterfaceJSFunction::StaticStruct() || FWebInterfaceJSStructReader::Find(StructProperty->Struct) != nullptr
+			: Param->IsA<UBoolProperty>() || Param->IsA<UNumericProperty>() || Param->IsA<UEnumProperty>()
+				|| Param->IsA<UStrProperty>() || Param->IsA<UNameProperty>() || Param->IsA<UTextProperty>());
+#endif
+
+		Plan->bDeserialize |= !Argument.bDirect;
+		Plan->Arguments.Add(Argument);
+	}
+
+	// Converted objects hold a binding for each time they're sent, so results with objects can't be sent twice
+	if (Plan->ReturnParam && !Plan->PromiseParam && Function->HasAnyFunctionFlags(FUNC_BlueprintPure))
+	{
+#if UE_VERSION >= 425
+		TArray<const FStructProperty*> EncounteredStructProps;
+#else
+		TArray<const UStructProperty*> EncounteredStructProps;
+#endif
+		Plan->bMemoizable = !Plan->ReturnParam->ContainsObjectReference(EncounteredStructProps);
+	}
+
+	if (Plan->ReturnParam && !Plan->PromiseParam)
+	{
+		Plan->MakeTypedArray = FindTypedArray(Plan->ReturnParam);
+	}
+
+	InvocationPlans.Add(Key, Plan);
+	return Plan;
+}
+
+uint8* FCEFInterfaceJSScripting::AllocateFrame(FInvocationPlan& Plan)
+{
+	UFunction* Function = Plan.Function.Get();
+
+	uint8* Params = Plan.Frames.Num() > 0
+		? Plan.Frames.Pop(false)
+		: (uint8*)FMemory::Malloc(Function->GetStructureSize(), Function->GetMinAlignment());
+
+	Function->InitializeStruct(Params);
+	return Params;
+}
+
+void FCEFInterfaceJSScripting::ReleaseFrame(FInvocationPlan& Plan, uint8* Params)
+{
+	// Frames of direct calls are released before garbage collection can run, async frames hold on to the function
+	UFunction* Function = Plan.AsyncFunction.IsValid() ? Plan.AsyncFunction.Get() : Plan.Function.Get();
+	Function->DestroyStruct(Params);
+
+	// Keep a few frames around for nested and repeated calls, unless the function has been replaced
+	if (Plan.Function.IsValid() && Plan.Frames.Num() < 4)
+	{
+		Plan.Frames.Add(Params);
+	}
+	else
+	{
+		FMemory::Free(Params);
+	}
+}
+
+void FCEFInterfaceJSScripting::ReleaseAsyncFrame(FInvocationPlan& Plan, uint8* Params)
+{
+	ReleaseFrame(Plan, Params);
+
+	if (--Plan.AsyncFrames == 0)
+	{
+		Plan.AsyncFunction.Reset();
+	}
+}
+
+bool FCEFInterfaceJSScripting::CallInterfaceFunction(const FString& Function, const FWebInterfaceJSParam* Data)
+{
+	if (!IsValid() || Dispatcher == nullptr)
+	{
+		return false;
+	}
+
+	return Dispatcher->Call(Function, Data);
+}
+
+bool FCEFInterfaceJSScripting::CallInterfaceFunctions(const FWebInterfaceJSParam& Calls)
+{
+	if (!IsValid() || Dispatcher == nullptr)
+	{
+		return false;
+	}
+
+	return Dispatcher->CallBatch(Calls);
+}
+
+FString FCEFInterfaceJSScripting::GetDispatcherScript()
+{
+	const FString DispatcherName = GetBindingName(TEXT("$dispatch"), nullptr);
+	if (Dispatcher == nullptr)
+	{
+		Dispatcher = NewObject<UWebInterfaceJSDispatcher>();
+		BindUObject(DispatcherName, Dispatcher, true);
+	}
+
+	// Resolve the function when called, as the page may replace ue.interface members at any time
+	// A single array argument is a batch of [name, data, typed] calls
+	// Typed arrays are sent as { $typedarray, $data }, ue.$typedarray restores them and encodes them for calls back to UE
+	// Methods of bound objects are wrapped so callbacks passed to them and their results get typed arrays restored too
+	// ue.$batch(object, method, ...args) gathers method calls until the next microtask and sends them as one message
+	// Observed properties arrive as a call to $observed and are set on the bound objects, ue.$watch(name, property, fn) listens for them
+	return FString::Printf(TEXT("typeof ue != 'undefined' && typeof ue['%s'] != 'undefined' && (function(){ ")
+		TEXT("var t = ue['$typedarray'] = { ")
+		TEXT("decode: function(v){ var s = atob(v['$data']), b = new Uint8Array(s.length); for (var i = 0; i < s.length; i++) b[i] = s.charCodeAt(i); return v['$typedarray'] == 'Float32' ? new Float32Array(b.buffer) : v['$typedarray'] == 'Int32' ? new Int32Array(b.buffer) : b; }, ")
+		TEXT("encode: function(a){ var b = new Uint8Array(a.buffer, a.byteOffset, a.byteLength), s = ''; for (var i = 0; i < b.length; i += 8192) s += String.fromCharCode.apply(null, b.subarray(i, i + 8192)); return { '$typedarray': a instanceof Float32Array ? 'Float32' : a instanceof Int32Array ? 'Int32' : 'Uint8', '$data': btoa(s) }; }, ")
+		TEXT("restore: function(v){ if (v === null || typeof v != 'object') return v; if (typeof v['$typedarray'] == 'string') return t.decode(v); for (var k in v) v[k] = t.restore(v[k]); return v; }, ")
+		TEXT("wrap: function(n){ var o = ue[n]; if (n == 'interface' || n.charAt(0) == '$' || o === null || typeof o != 'object' || o['$wrapped']) return; Object.defineProperty(o, '$wrapped', { value: true }); ")
+		TEXT("Object.keys(o).forEach(function(k){ var f = o[k]; if (typeof f == 'function') o[k] = function(){ var r = f.apply(o, Array.prototype.map.call(arguments, function(a){ return typeof a == 'function' ? function(){ return a.apply(this, Array.prototype.map.call(arguments, t.restore)); } : a; })); return r && typeof r.then == 'function' ? r.then(t.restore) : r; }; }); } }; ")
+		TEXT("Object.keys(ue).forEach(t.wrap); ")
+		TEXT("var w = [], o = function(d){ var c = []; for (var n in d){ var b = ue[n]; if (b === null || typeof b != 'object') continue; for (var k in d[n]){ c.push([n, k, d[n][k], b[k]]); b[k] = d[n][k]; } } ")
+		TEXT("w.slice().forEach(function(h){ c.forEach(function(x){ if (h[0] == x[0] && (!h[1] || h[1] == x[1])) h[2](x[2], x[3], x[1]); }); }); }; ")
+		TEXT("ue['$watch'] = function(n, k, f){ var h = [n, k, f]; w.push(h); return function(){ var i = w.indexOf(h); if (i >= 0) w.splice(i, 1); }; }; ")
+		TEXT("ue['%s'].%s(function(n){ var c = function(e){ if (e[0] == '$observed') return o(e[1]); if (typeof ue.interface != 'undefined' && typeof ue.interface[e[0]] == 'function') e.length > 1 ? ue.interface[e[0]](e[2] ? t.restore(e[1]) : e[1]) : ue.interface[e[0]](); }; Array.isArray(n) ? n.forEach(c) : c(Array.prototype.slice.call(arguments)); }); ")
+		TEXT("var q = []; ue['$batch'] = function(o, m){ var a = Array.prototype.slice.call(arguments, 2); return new Promise(function(res, rej){ if (q.push([o, m, a, res, rej]) == 1) Promise.resolve().then(function(){ ")
+		TEXT("var b = q; q = []; ue['%s'].%s(b.map(function(e){ return [e[0], e[1], e[2]]; })).then(function(r){ r.forEach(function(x, i){ var e = b[i]; x[0] == 0 ? e[3](t.restore(x[1])) : x[0] == 1 ? e[4](x[1]) : e[0][e[1]].apply(e[0], e[2]).then(e[3], e[4]); }); }, function(x){ b.forEach(function(e){ e[4](x); }); }); }); }); }; ")
+		TEXT("})();"),
+		*DispatcherName,
+		*DispatcherName,
+		*GetBindingName(TEXT("Attach"), Dispatcher),
+		*DispatcherName,
+		*GetBindingName(TEXT("Batch"), Dispatcher));
+}
+
+void FCEFInterfaceJSScripting::DetachDispatcher()
+{
+	if (Dispatcher)
+	{
+		Dispatcher->Detach();
+	}
+
+	// The next document starts without any values
+	for (const TSharedPtr<FObservedObject>& Observed : ObservedObjects)
+	{
+		Observed->Reset();
+	}
+}
+
+void FCEFInterfaceJSScripting::FObservedObject::Reset()
+{
+	for (FObservedProperty& Observed : Properties)
+	{
+		if (Observed.Value == nullptr)
+		{
+			continue;
+		}
+
+		if (Class.IsValid())
+		{
+			Observed.Property->DestroyValue(Observed.Value);
+		}
+		FMemory::Free(Observed.Value);
+		Observed.Value = nullptr;
+	}
+}
+
+void FCEFInterfaceJSScripting::ObserveUObject(const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame)
+{
+	if (Object == nullptr)
+	{
+		return;
+	}
+
+	UnobserveUObject(Name, Object);
+
+	TSharedPtr<FObservedObject> Observed = MakeShared<FObservedObject>();
+	Observed->Name = GetBindingName(Name, Object);
+	Observed->Object = Object;
+	Observed->Class = Object->GetClass();
+	Observed->bEveryFrame = bEveryFrame;
+	Observed->bDirty = true;
+
+#if UE_VERSION >= 425
+	for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+#else
+	for (TFieldIterator<UProperty> It(Object->GetClass()); It; ++It)
+#endif
+	{
+		// Only what blueprints can see is exposed
+		if (It->HasAnyPropertyFlags(CPF_BlueprintVisible) && (Properties.Num() == 0 || Properties.Contains(It->GetFName())))
+		{
+			Observed->Properties.Add(FObservedProperty{ *It, nullptr });
+		}
+	}
+
+	if (Observed->Properties.Num() == 0)
+	{
+		return;
+	}
+
+	ObservedObjects.Add(Observed);
+
+	if (!ObservedHandle.IsValid() && IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable())
+	{
+		ObservedHandle = IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().AddSP(this, &FCEFInterfaceJSScripting::PushObservedProperties);
+	}
+}
+
+void FCEFInterfaceJSScripting::UnobserveUObject(const FString& Name, UObject* Object)
+{
+	const FString BindingName = GetBindingName(Name, Object);
+	ObservedObjects.RemoveAll([&](const TSharedPtr<FObservedObject>& Observed)
+	{
+		return Observed->Name == BindingName && (Object == nullptr || Observed->Object.Get() == Object);
+	});
+}
+
+void FCEFInterfaceJSScripting::MarkUObjectDirty(UObject* Object)
+{
+	for (const TSharedPtr<FObservedObject>& Observed : ObservedObjects)
+	{
+		if (Observed->Object.Get() == Object)
+		{
+			Observed->bDirty = true;
+		}
+	}
+}
+
+void FCEFInterfaceJSScripting::PushObservedProperties()
+{
+	ObservedObjects.RemoveAll([](const TSharedPtr<FObservedObject>& Observed)
+	{
+		return !Observed->Object.IsValid();
+	});
+
+	if (ObservedObjects.Num() == 0)
+	{
+		if (IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable())
+		{
+			IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().Remove(ObservedHandle);
+		}
+		ObservedHandle.Reset();
+		return;
+	}
+
+	// Changes wait for the next document to attach
+	if (!IsValid() || Dispatcher == nullptr || !Dispatcher->IsAttached())
+	{
+		return;
+	}
+
+	CefRefPtr<CefDictionaryValue> Changes = CefDictionaryValue::Create();
+	for (const TSharedPtr<FObservedObject>& Observed : ObservedObjects)
+	{
+		if (!Observed->bEveryFrame && !Observed->bDirty)
+		{
+			continue;
+		}
+		Observed->bDirty = false;
+
+		UObject* Object = Observed->Object.Get();
+
+#if UE_VERSION >= 425
+		TSet<const FProperty*> Changed;
+#else
+		TSet<const UProperty*> Changed;
+#endif
+		for (FObservedProperty& Property : Observed->Properties)
+		{
+			const uint8* Current = Property.Property->ContainerPtrToValuePtr<uint8>(Object);
+			if (Property.Value != nullptr)
+			{
+				bool bIdentical = true;
+				for (int32 Index = 0; bIdentical && Index < Property.Property->ArrayDim; Index++)
+				{
+					const int32 Offset = Index * Property.Property->ElementSize;
+					bIdentical = Property.Property->Identical(Current + Offset, Property.Value + Offset);
+				}
+
+				if (bIdentical)
+				{
+					continue;
+				}
+			}
+			else
+			{
+				Property.Value = (uint8*)FMemory::Malloc(Property.Property->GetSize(), Property.Property->GetMinAlignment());
+				Property.Property->InitializeValue(Property.Value);
+			}
+
+			Property.Property->CopyCompleteValue(Property.Value, Current);
+			Changed.Add(Property.Property);
+		}
+
+		if (Changed.Num() == 0)
+		{
+			continue;
+		}
+
+		// Serialize only the changed properties, straight from the object
+		FStructSerializerPolicies Policies;
+#if UE_VERSION >= 425
+		Policies.PropertyFilter = [&](const FProperty* CandidateProperty, const FProperty* ParentProperty)
+#else
+		Policies.PropertyFilter = [&](const UProperty* CandidateProperty, const UProperty* ParentProperty)
+#endif
+		{
+			return ParentProperty != nullptr || Changed.Contains(CandidateProperty);
+		};
+		FCEFInterfaceJSStructSerializerBackend Backend(SharedThis(this));
+		FStructSerializer::Serialize(Object, *Object->GetClass(), Backend, Policies);
+
+		Changes->SetDictionary(TCHAR_TO_WCHAR(*Observed->Name), Backend.GetResult());
+	}
+
+	if (Changes->GetSize() == 0)
+	{
+		return;
+	}
+
+	// All objects go out in one message, built as the dispatcher's [name, data] arguments so the values aren't converted again
+	CefRefPtr<CefListValue> Arguments = CefListValue::Create();
+	Arguments->SetString(0, TCHAR_TO_WCHAR(TEXT("$observed")));
+	Arguments->SetDictionary(1, Changes);
+	InvokeJSFunction(Dispatcher->GetFunctionId(), Arguments);
+}
+
+void FCEFInterfaceJSScripting::UnbindCefBrowser()
+{
+	InternalCefBrowser = nullptr;
+}
+
+void FCEFInterfaceJSScripting::InvokeJSErrorResult(FGuid FunctionId, const FString& Error)
+{
+	CefRefPtr<CefListValue> FunctionArguments = CefListValue::Create();
+	FunctionArguments->SetString(0, TCHAR_TO_WCHAR(*Error));
+	InvokeJSFunction(FunctionId, FunctionArguments, true);
+}
+
+void FCEFInterfaceJSScripting::InvokeJSFunction(FGuid FunctionId, int32 ArgCount, FWebInterfaceJSParam Arguments[], bool bIsError)
+{
+	CefRefPtr<CefListValue> FunctionArguments = CefListValue::Create();
+	for ( int32 i=0; i<ArgCount; i++)
+	{
+		SetConverted(FunctionArguments, i, Arguments[i]);
+	}
+	InvokeJSFunction(FunctionId, FunctionArguments, bIsError);
+}
+
+void FCEFInterfaceJSScripting::ProfileCall(const FGuid& ResultCallbackId, FName Name)
+{
+	if (!FWebInterfaceJSProfiler::IsEnabled())
+	{
+		return;
+	}
+
+	// Responses that are never called would otherwise be kept forever
+	if (ProfiledCalls.Num() >= 4096)
+	{
+		ProfiledCalls.Reset();
+	}
+	ProfiledCalls.Add(ResultCallbackId, TPair<FName, double>(Name, FPlatformTime::Seconds()));
+}
+
+void FCEFInterfaceJSScripting::InvokeJSFunction(FGuid FunctionId, const CefRefPtr<CefListValue>& FunctionArguments, bool bIsError)
+{
+	TPair<FName, double> ProfiledCall;
+	if (ProfiledCalls.Num() > 0 && ProfiledCalls.RemoveAndCopyValue(FunctionId, ProfiledCall))
+	{
+		// Measured from receiving the call to sending its result, the renderer's part isn't included
+		FWebInterfaceJSProfiler::AddResult(ProfiledCall.Key, SizeCefList(FunctionArguments), FPlatformTime::Seconds() - ProfiledCall.Value);
 	}
-	InvokeJSFunction(FunctionId, FunctionArguments, bIsError);
-}
 
-void FCEFInterfaceJSScripting::InvokeJSFunction(FGuid FunctionId, const CefRefPtr<CefListValue>& FunctionArguments, bool bIsError)
-{
 	CefRefPtr<CefProcessMessage> Message = CefProcessMessage::Create(TCHAR_TO_WCHAR(TEXT("UE::ExecuteJSFunction")));
 	CefRefPtr<CefListValue> MessageArguments = Message->GetArgumentList();
 	MessageArguments->SetString(0, TCHAR_TO_WCHAR(*FunctionId.ToString(EGuidFormats::Digits)));
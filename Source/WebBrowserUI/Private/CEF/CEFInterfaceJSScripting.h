@@ -4,6 +4,8 @@
 #include "CoreMinimal.h"
 
 #if WITH_CEF3
+#include "Misc/Base64.h"
+#include "UObject/StrongObjectPtr.h"
 #include "WebInterfaceJSFunction.h"
 #include "WebInterfaceJSScripting.h"
 
@@ -32,6 +34,7 @@ THIRD_PARTY_INCLUDES_END
 
 class Error;
 class FWebInterfaceJSScripting;
+class UWebInterfaceJSDispatcher;
 struct FWebInterfaceJSParam;
 
 #if WITH_CEF3
@@ -49,6 +52,8 @@ public:
 		, InternalCefBrowser(Browser)
 	{}
 
+	virtual ~FCEFInterfaceJSScripting();
+
 	void UnbindCefBrowser();
 
 	virtual void BindUObject(const FString& Name, UObject* Object, bool bIsPermanent = true) override;
@@ -129,17 +134,169 @@ public:
 				}
 				return Container->SetDictionary(Key, ConvertedMap);
 			}
+			case FWebInterfaceJSParam::PTYPE_TYPED_ARRAY:
+			{
+				// The renderer has no typed arrays, so send the data as one string instead of a value per element
+				CefRefPtr<CefDictionaryValue> ConvertedArray = CefDictionaryValue::Create();
+				ConvertedArray->SetString("$typedarray", TCHAR_TO_WCHAR(Param.TypedArrayValue->GetTypeName()));
+				ConvertedArray->SetString("$data", TCHAR_TO_WCHAR(*FBase64::Encode(Param.TypedArrayValue->Data)));
+				return Container->SetDictionary(Key, ConvertedArray);
+			}
 			default:
 				return false;
 		}
 	}
 
+	// Works for CefListValue and CefDictionaryValues
+	template<typename ContainerType, typename KeyType>
+	FWebInterfaceJSParam GetConverted(CefRefPtr<ContainerType> Container, KeyType Key)
+	{
+		switch (Container->GetType(Key))
+		{
+			case VTYPE_BOOL:
+				return FWebInterfaceJSParam(Container->GetBool(Key));
+			case VTYPE_INT:
+				return FWebInterfaceJSParam((int32)Container->GetInt(Key));
+			case VTYPE_DOUBLE:
+				return FWebInterfaceJSParam(Container->GetDouble(Key));
+			case VTYPE_STRING:
+				return FWebInterfaceJSParam(FString(WCHAR_TO_TCHAR(Container->GetString(Key).ToWString().c_str())));
+			case VTYPE_LIST:
+			{
+				CefRefPtr<CefListValue> List = Container->GetList(Key);
+
+				FWebInterfaceJSParam Param;
+				Param.Tag = FWebInterfaceJSParam::PTYPE_ARRAY;
+				Param.ArrayValue = new TArray<FWebInterfaceJSParam>();
+				Param.ArrayValue->Reserve((int32)List->GetSize());
+				for (size_t i = 0; i < List->GetSize(); ++i)
+				{
+					Param.ArrayValue->Add(GetConverted(List, i));
+				}
+				return Param;
+			}
+			case VTYPE_DICTIONARY:
+			{
+				CefRefPtr<CefDictionaryValue> Dictionary = Container->GetDictionary(Key);
+				if (Dictionary->GetType("$type") == VTYPE_STRING)
+				{
+					// Only bound objects have a native representation, functions and structs are dropped
+					FGuid ObjectKey;
+					if (FString(WCHAR_TO_TCHAR(Dictionary->GetString("$type").ToWString().c_str())) == TEXT("uobject")
+						&& ParseId(FString(WCHAR_TO_TCHAR(Dictionary->GetString("$id").ToWString().c_str())), ObjectKey))
+					{
+						return FWebInterfaceJSParam(GuidToPtr(ObjectKey));
+					}
+					return FWebInterfaceJSParam();
+				}
+
+				FWebInterfaceJSParam::FTypedArray::EType TypedArrayType;
+				if (Dictionary->GetType("$typedarray") == VTYPE_STRING && Dictionary->GetType("$data") == VTYPE_STRING
+					&& FWebInterfaceJSParam::FTypedArray::FindType(WCHAR_TO_TCHAR(Dictionary->GetString("$typedarray").ToWString().c_str()), TypedArrayType))
+				{
+					FWebInterfaceJSParam Param;
+					Param.Tag = FWebInterfaceJSParam::PTYPE_TYPED_ARRAY;
+					Param.TypedArrayValue = new FWebInterfaceJSParam::FTypedArray();
+					Param.TypedArrayValue->Type = TypedArrayType;
+					FBase64::Decode(WCHAR_TO_TCHAR(Dictionary->GetString("$data").ToWString().c_str()), Param.TypedArrayValue->Data);
+					return Param;
+				}
+
+				CefDictionaryValue::KeyList Keys;
+				Dictionary->GetKeys(Keys);
+
+				FWebInterfaceJSParam Param;
+				Param.Tag = FWebInterfaceJSParam::PTYPE_MAP;
+				Param.MapValue = new TMap<FString, FWebInterfaceJSParam>();
+				Param.MapValue->Reserve((int32)Keys.size());
+				for (const CefString& Name : Keys)
+				{
+					Param.MapValue->Add(WCHAR_TO_TCHAR(Name.ToWString().c_str()), GetConverted(Dictionary, Name));
+				}
+				return Param;
+			}
+			case VTYPE_NULL:
+			default:
+				return FWebInterfaceJSParam();
+		}
+	}
+
 	CefRefPtr<CefDictionaryValue> GetPermanentBindings();
 
 	void InvokeJSFunction(FGuid FunctionId, int32 ArgCount, FWebInterfaceJSParam Arguments[], bool bIsError=false) override;
 	void InvokeJSFunction(FGuid FunctionId, const CefRefPtr<CefListValue>& FunctionArguments, bool bIsError=false);
 	void InvokeJSErrorResult(FGuid FunctionId, const FString& Error) override;
 
+	/**
+	 * Calls ue.interface[Function] through the function attached by the page, sending the argument as native values.
+	 *
+	 * @return false if the page hasn't attached yet, in which case the caller should fall back to executing a script.
+	 */
+	bool CallInterfaceFunction(const FString& Function, const FWebInterfaceJSParam* Data);
+
+	/** Calls several ue.interface functions in order with a single message, see UWebInterfaceJSDispatcher::CallBatch. */
+	bool CallInterfaceFunctions(const FWebInterfaceJSParam& Calls);
+
+	/** Returns the script that attaches the current document to the dispatcher, binding the dispatcher if needed. */
+	FString GetDispatcherScript();
+
+	/** Forgets the function attached by the current document. */
+	void DetachDispatcher();
+
+	/**
+	 * Sends the values of properties of an object bound as ue[Name] to the page, and then only the ones that changed.
+	 * Changes are gathered once per frame and sent with a single message through the dispatcher.
+	 *
+	 * @param Name The name the object is bound with.
+	 * @param Object The object to observe.
+	 * @param Properties The blueprint visible properties to send, or empty to send all of them.
+	 * @param bEveryFrame Whether to check for changes every frame, otherwise only after MarkUObjectDirty.
+	 */
+	void ObserveUObject(const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame);
+
+	/** Stops sending property changes for an object, or for every object observed with the name if Object is null. */
+	void UnobserveUObject(const FString& Name, UObject* Object);
+
+	/** Checks the observed properties of an object for changes at the end of the frame. */
+	void MarkUObjectDirty(UObject* Object);
+
+	/**
+	 * Runs methods of an object on a worker thread when they are called from the page, instead of on the game thread.
+	 * Arguments are read and results are sent on the game thread, a FWebInterfaceJSResponse can be resolved from any thread.
+	 * Calls made as part of a batch still run on the game thread.
+	 *
+	 * @param Object The object the methods belong to.
+	 * @param Methods The methods that are safe to call off the game thread, or empty to run all of them on the game thread again.
+	 */
+	void SetUObjectAsyncMethods(UObject* Object, const TArray<FName>& Methods);
+
+	/**
+	 * Reuses results of blueprint pure methods of an object called with the same arguments during a frame.
+	 * Cached results are dropped at the next frame, and when any other method of the object is called from the page.
+	 *
+	 * @param Object The object whose results are kept.
+	 * @param bMemoize Whether to keep results, the ones already kept are dropped if false.
+	 */
+	void SetUObjectMemoized(UObject* Object, bool bMemoize);
+
+	/**
+	 * Sends float, int32, uint8 and FVector arrays returned by methods of an object as typed arrays instead of plain arrays.
+	 *
+	 * @param Object The object whose methods return typed arrays.
+	 * @param bTypedArrays Whether to send typed arrays.
+	 */
+	void SetUObjectTypedArrays(UObject* Object, bool bTypedArrays);
+
+	/** Drops the results kept for an object, for when something other than its methods changed what they return. */
+	void InvalidateUObject(UObject* Object);
+
+	// FGCObject API
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+protected:
+
+	virtual void FlushClassCaches() override;
+
 private:
 
 #if UE_VERSION >= 425
@@ -156,8 +313,172 @@ private:
 	/** Message handling helpers */
 
 	bool HandleExecuteUObjectMethodMessage(CefRefPtr<CefListValue> MessageArguments);
+	bool HandleBatchMessage(CefRefPtr<CefListValue> BatchArguments, const FGuid& ResultCallbackId);
+
+	/** Outcome of a method called from the renderer, also the status of each reply to a batch. */
+	enum class EMethodResult : int32
+	{
+		Completed,
+		Failed,
+		/** The method reports through its FWebInterfaceJSResponse. */
+		Pending,
+		/** The method takes a FWebInterfaceJSResponse, which needs a callback of its own, so it has to be called directly. */
+		NotBatchable,
+	};
+
+	/**
+	 * Calls a method with arguments from the renderer.
+	 * Results receives the return value when completed, or the error when failed.
+	 */
+	EMethodResult InvokeUObjectMethod(UObject* Object, const FName& MethodName, CefRefPtr<CefListValue> CefArgs, const FGuid& ResultCallbackId, bool bAllowResponse, CefRefPtr<CefListValue>& Results);
 	bool HandleReleaseUObjectMessage(CefRefPtr<CefListValue> MessageArguments);
 
+	/** A single argument of a cached method. */
+	struct FInvocationArgument
+	{
+#if UE_VERSION >= 425
+		FProperty* Property;
+#else
+		UProperty* Property;
+#endif
+		CefString Name;
+		/** Whether the argument can be read without the struct deserializer. */
+		bool bDirect;
+	};
+
+	/** Resolved method and parameter layout, cached per class so repeated calls skip reflection. */
+	struct FInvocationPlan
+	{
+		~FInvocationPlan()
+		{
+			for (uint8* Frame : Frames)
+			{
+				FMemory::Free(Frame);
+			}
+		}
+
+		TWeakObjectPtr<UFunction> Function;
+		TArray<FInvocationArgument> Arguments;
+#if UE_VERSION >= 425
+		FProperty* ReturnParam = nullptr;
+		FProperty* PromiseParam = nullptr;
+#else
+		UProperty* ReturnParam = nullptr;
+		UProperty* PromiseParam = nullptr;
+#endif
+		bool bDeserialize = false;
+		/** Whether results can be reused for calls with the same arguments, for blueprint pure functions that don't return objects. */
+		bool bMemoizable = false;
+		/** Class.Method, what the profiler records calls under. */
+		FName ProfileName;
+		/** Copies a numeric array return value into a typed array, or null if the method doesn't return one. */
+		FWebInterfaceJSParam::FTypedArray (*MakeTypedArray)(const void* Array) = nullptr;
+
+		/** Parameter frames that were released and can be reused by the next call. */
+		TArray<uint8*> Frames;
+
+		/** Frames of calls running on a worker thread, the function is kept alive until they are released so their values can be destroyed. */
+		int32 AsyncFrames = 0;
+		TStrongObjectPtr<UFunction> AsyncFunction;
+	};
+
+	TSharedPtr<FInvocationPlan> GetInvocationPlan(UObject* Object, const FName& MethodName);
+	uint8* AllocateFrame(FInvocationPlan& Plan);
+	static void ReleaseFrame(FInvocationPlan& Plan, uint8* Params);
+	static void ReleaseAsyncFrame(FInvocationPlan& Plan, uint8* Params);
+
+	/** Allocates a parameter frame and fills it with arguments from the renderer, or returns null if the method has no parameters. */
+	uint8* ReadArguments(FInvocationPlan& Plan, CefRefPtr<CefListValue> CefArgs, const FGuid& ResultCallbackId);
+	/** Adds the return value in a parameter frame to Results. */
+	void WriteReturnValue(UObject* Object, FInvocationPlan& Plan, uint8* Params, CefRefPtr<CefListValue>& Results);
+
+	/** Calls a method on a worker thread, and reports its result once it returns. */
+	void InvokeUObjectMethodAsync(UObject* Object, const FName& MethodName, CefRefPtr<CefListValue> CefArgs, const FGuid& ResultCallbackId);
+	void CompleteUObjectMethodAsync(UObject* Object, FInvocationPlan& Plan, uint8* Params, const FGuid& ResultCallbackId, bool bCalled, uint64 ProcessCycles);
+	bool IsAsyncMethod(UObject* Object, const FName& MethodName) const;
+
+	/** Cached invocation plans by class and method name. */
+	TMap<TPair<UClass*, FName>, TSharedPtr<FInvocationPlan>> InvocationPlans;
+
+	/** Binding names of the methods of each class, copied into every converted object. */
+	TMap<UClass*, CefRefPtr<CefListValue>> ClassMethods;
+
+	/** A result kept for the arguments it was returned for. */
+	struct FMemoizedResult
+	{
+		uint32 Hash;
+		CefRefPtr<CefListValue> Arguments;
+		CefRefPtr<CefListValue> Results;
+	};
+
+	/** Results kept for an object during a frame. */
+	struct FMemoizedObject
+	{
+		uint64 Frame = 0;
+		TMap<FName, TArray<FMemoizedResult>> Methods;
+	};
+
+	/** Objects whose pure method results are kept. */
+	TMap<TWeakObjectPtr<UObject>, FMemoizedObject> MemoizedObjects;
+
+	/** Objects whose numeric array results are sent as typed arrays. */
+	TSet<TWeakObjectPtr<UObject>> TypedArrayObjects;
+
+	/** Methods that run on a worker thread, by object. */
+	TMap<TWeakObjectPtr<UObject>, TSet<FName>> AsyncMethods;
+
+	/** Objects with a method running on a worker thread, one entry per call. */
+#if UE_VERSION >= 500
+	TArray<TObjectPtr<UObject>> AsyncObjects;
+#else
+	TArray<UObject*> AsyncObjects;
+#endif
+
+	/** Calls waiting for their result while profiling, with the name they're recorded under and when they were received. */
+	TMap<FGuid, TPair<FName, double>> ProfiledCalls;
+	void ProfileCall(const FGuid& ResultCallbackId, FName Name);
+
+	/** A property sent to the page, with the value it was last sent with. */
+	struct FObservedProperty
+	{
+#if UE_VERSION >= 425
+		FProperty* Property;
+#else
+		UProperty* Property;
+#endif
+		/** Null until the value has been sent. */
+		uint8* Value;
+	};
+
+	/** An object whose properties are sent to the page when they change. */
+	struct FObservedObject
+	{
+		~FObservedObject()
+		{
+			Reset();
+		}
+
+		/** Forget the values that were sent, so everything is sent again. */
+		void Reset();
+
+		FString Name;
+		TWeakObjectPtr<UObject> Object;
+		/** Values can only be destroyed while their class is around. */
+		TWeakObjectPtr<UClass> Class;
+		TArray<FObservedProperty> Properties;
+		bool bEveryFrame;
+		bool bDirty;
+	};
+
+	/** Sends the properties that changed since they were last sent, for every observed object. */
+	void PushObservedProperties();
+
+	TArray<TSharedPtr<FObservedObject>> ObservedObjects;
+	FDelegateHandle ObservedHandle;
+
+	/** Receives the forwarding function from each document, kept alive by its permanent binding. */
+	UWebInterfaceJSDispatcher* Dispatcher = nullptr;
+
 	/** Pointer to the CEF Browser for this window. */
 	CefRefPtr<CefBrowser> InternalCefBrowser;
 };
@@ -3,6 +3,7 @@
 #if WITH_CEF3
 #include "UObject/EnumProperty.h"
 #include "UObject/TextProperty.h"
+#include "Misc/Base64.h"
 #include "WebInterfaceJSFunction.h"
 
 /* Internal helpers
@@ -45,7 +46,7 @@ namespace {
 			case VTYPE_DICTIONARY:
 			{
 				CefRefPtr<CefDictionaryValue> Dictionary = Container->GetDictionary(Key);
-				if (Dictionary->GetType("$type") == VTYPE_STRING )
+				if (Dictionary->GetType("$type") == VTYPE_STRING || Dictionary->GetType("$typedarray") == VTYPE_STRING)
 				{
 					OutToken = EStructDeserializerBackendTokens::Property;
 				}
@@ -209,7 +210,7 @@ namespace {
 		}
 
 		FGuid CallbackID;
-		if (!FGuid::Parse(FString(WCHAR_TO_TCHAR(Dictionary->GetString("$id").ToWString().c_str())), CallbackID))
+		if (!FWebInterfaceJSScripting::ParseId(FString(WCHAR_TO_TCHAR(Dictionary->GetString("$id").ToWString().c_str())), CallbackID))
 		{
 			// Invalid GUID
 			return false;
@@ -218,6 +219,140 @@ namespace {
 		return SetPropertyValue(StructProperty, Outer, Data, ArrayIndex, CallbackObject);
 	}
 
+	template<typename ContainerType, typename KeyType>
+#if UE_VERSION >= 425
+	bool ReadRegisteredStructProperty(TSharedPtr<FCEFInterfaceJSScripting> Scripting, FProperty* Property, FProperty* Outer, void* Data, int32 ArrayIndex, CefRefPtr<ContainerType> Container, KeyType Key )
+#else
+	bool ReadRegisteredStructProperty(TSharedPtr<FCEFInterfaceJSScripting> Scripting, UProperty* Property, UProperty* Outer, void* Data, int32 ArrayIndex, CefRefPtr<ContainerType> Container, KeyType Key )
+#endif
+	{
+#if UE_VERSION >= 425
+		FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+#else
+		UStructProperty* StructProperty = Cast<UStructProperty>(Property);
+#endif
+
+		if (!StructProperty)
+		{
+			return false;
+		}
+
+		const FWebInterfaceJSStructReader::FReader* Reader = FWebInterfaceJSStructReader::Find(StructProperty->Struct);
+		if (!Reader)
+		{
+			return false;
+		}
+
+		if (void* Ptr = GetPropertyValuePtr(StructProperty, Outer, Data, ArrayIndex))
+		{
+			(*Reader)(Scripting->GetConverted(Container, Key), Ptr);
+			return true;
+		}
+
+		return false;
+	}
+
+	template<typename ContainerType, typename KeyType>
+#if UE_VERSION >= 425
+	bool ReadTypedArrayProperty(FProperty* Property, FProperty* Outer, void* Data, int32 ArrayIndex, CefRefPtr<ContainerType> Container, KeyType Key )
+#else
+	bool ReadTypedArrayProperty(UProperty* Property, UProperty* Outer, void* Data, int32 ArrayIndex, CefRefPtr<ContainerType> Container, KeyType Key )
+#endif
+	{
+#if UE_VERSION >= 425
+		FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+#else
+		UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property);
+#endif
+
+		if (!ArrayProperty || Container->GetType(Key) != VTYPE_DICTIONARY)
+		{
+			return false;
+		}
+
+		CefRefPtr<CefDictionaryValue> Dictionary = Container->GetDictionary(Key);
+		if (Dictionary->GetType("$typedarray") != VTYPE_STRING || Dictionary->GetType("$data") != VTYPE_STRING)
+		{
+			return false;
+		}
+
+		FWebInterfaceJSParam::FTypedArray TypedArray;
+		if (!FWebInterfaceJSParam::FTypedArray::FindType(WCHAR_TO_TCHAR(Dictionary->GetString("$typedarray").ToWString().c_str()), TypedArray.Type)
+			|| !FBase64::Decode(WCHAR_TO_TCHAR(Dictionary->GetString("$data").ToWString().c_str()), TypedArray.Data))
+		{
+			return false;
+		}
+
+		void* ArrayPtr = GetPropertyValuePtr(ArrayProperty, Outer, Data, ArrayIndex);
+		if (!ArrayPtr)
+		{
+			return false;
+		}
+
+		FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayPtr);
+		const int32 Count = TypedArray.Num();
+
+#if UE_VERSION >= 425
+		FNumericProperty* NumericProperty = CastField<FNumericProperty>(ArrayProperty->Inner);
+		FStructProperty* StructProperty = CastField<FStructProperty>(ArrayProperty->Inner);
+#else
+		UNumericProperty* NumericProperty = Cast<UNumericProperty>(ArrayProperty->Inner);
+		UStructProperty* StructProperty = Cast<UStructProperty>(ArrayProperty->Inner);
+#endif
+
+		// Copy the block as is when the layout matches
+		const bool bSameLayout =
+#if UE_VERSION >= 425
+			(TypedArray.Type == FWebInterfaceJSParam::FTypedArray::Float32 && ArrayProperty->Inner->IsA<FFloatProperty>())
+			|| (TypedArray.Type == FWebInterfaceJSParam::FTypedArray::Int32 && ArrayProperty->Inner->IsA<FIntProperty>())
+			|| (TypedArray.Type == FWebInterfaceJSParam::FTypedArray::Uint8 && ArrayProperty->Inner->IsA<FByteProperty>());
+#else
+			(TypedArray.Type == FWebInterfaceJSParam::FTypedArray::Float32 && ArrayProperty->Inner->IsA<UFloatProperty>())
+			|| (TypedArray.Type == FWebInterfaceJSParam::FTypedArray::Int32 && ArrayProperty->Inner->IsA<UIntProperty>())
+			|| (TypedArray.Type == FWebInterfaceJSParam::FTypedArray::Uint8 && ArrayProperty->Inner->IsA<UByteProperty>());
+#endif
+
+		if (bSameLayout)
+		{
+			ArrayHelper.EmptyAndAddUninitializedValues(Count);
+			if (Count > 0)
+			{
+				FMemory::Memcpy(ArrayHelper.GetRawPtr(0), TypedArray.Data.GetData(), Count * ArrayProperty->Inner->ElementSize);
+			}
+			return true;
+		}
+
+		// Vectors are flattened to x, y, z
+		if (StructProperty && StructProperty->Struct == TBaseStructure<FVector>::Get())
+		{
+			ArrayHelper.EmptyAndAddValues(Count / 3);
+			for (int32 i = 0; i < Count / 3; ++i)
+			{
+				*(FVector*)ArrayHelper.GetRawPtr(i) = FVector(TypedArray.GetValue(i * 3), TypedArray.GetValue(i * 3 + 1), TypedArray.GetValue(i * 3 + 2));
+			}
+			return true;
+		}
+
+		if (NumericProperty)
+		{
+			ArrayHelper.EmptyAndAddValues(Count);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				if (NumericProperty->IsFloatingPoint())
+				{
+					NumericProperty->SetFloatingPointPropertyValue(ArrayHelper.GetRawPtr(i), TypedArray.GetValue(i));
+				}
+				else
+				{
+					NumericProperty->SetIntPropertyValue(ArrayHelper.GetRawPtr(i), (int64)TypedArray.GetValue(i));
+				}
+			}
+			return true;
+		}
+
+		return false;
+	}
+
 	template<typename ContainerType, typename KeyType>
 #if UE_VERSION >= 425
 	bool ReadStringProperty(FProperty* Property, FProperty* Outer, void* Data, int32 ArrayIndex, CefRefPtr<ContainerType> Container, KeyType Key )
@@ -317,7 +452,9 @@ namespace {
 			|| ReadNumericProperty<FUInt64Property>(Property, Outer, Data, ArrayIndex, Container, Key)
 			|| ReadNumericProperty<FFloatProperty>(Property, Outer, Data, ArrayIndex, Container, Key)
 			|| ReadNumericProperty<FDoubleProperty>(Property, Outer, Data, ArrayIndex, Container, Key)
-			|| ReadJSFunctionProperty(Scripting, Property, Outer, Data, ArrayIndex, Container, Key);
+			|| ReadJSFunctionProperty(Scripting, Property, Outer, Data, ArrayIndex, Container, Key)
+			|| ReadRegisteredStructProperty(Scripting, Property, Outer, Data, ArrayIndex, Container, Key)
+			|| ReadTypedArrayProperty(Property, Outer, Data, ArrayIndex, Container, Key);
 	}
 #else
 	bool ReadProperty(TSharedPtr<FCEFInterfaceJSScripting> Scripting, UProperty* Property, UProperty* Outer, void* Data, int32 ArrayIndex, CefRefPtr<ContainerType> Container, KeyType Key )
@@ -334,7 +471,9 @@ namespace {
 			|| ReadNumericProperty<UUInt64Property>(Property, Outer, Data, ArrayIndex, Container, Key)
 			|| ReadNumericProperty<UFloatProperty>(Property, Outer, Data, ArrayIndex, Container, Key)
 			|| ReadNumericProperty<UDoubleProperty>(Property, Outer, Data, ArrayIndex, Container, Key)
-			|| ReadJSFunctionProperty(Scripting, Property, Outer, Data, ArrayIndex, Container, Key);
+			|| ReadJSFunctionProperty(Scripting, Property, Outer, Data, ArrayIndex, Container, Key)
+			|| ReadRegisteredStructProperty(Scripting, Property, Outer, Data, ArrayIndex, Container, Key)
+			|| ReadTypedArrayProperty(Property, Outer, Data, ArrayIndex, Container, Key);
 	}
 #endif
 }
@@ -447,6 +586,16 @@ bool FCEFInterfaceJSStructDeserializerBackend::ReadProperty( UProperty* Property
 }
 
 
+#if UE_VERSION >= 425
+bool FCEFInterfaceJSStructDeserializerBackend::ReadArgument(TSharedPtr<FCEFInterfaceJSScripting> Scripting, FProperty* Property, void* Data, CefRefPtr<CefListValue> List, int32 Index)
+#else
+bool FCEFInterfaceJSStructDeserializerBackend::ReadArgument(TSharedPtr<FCEFInterfaceJSScripting> Scripting, UProperty* Property, void* Data, CefRefPtr<CefListValue> List, int32 Index)
+#endif
+{
+	return ::ReadProperty(Scripting, Property, nullptr, Data, 0, List, Index);
+}
+
+
 void FCEFInterfaceJSStructDeserializerBackend::SkipArray()
 {
 	EStructDeserializerBackendTokens Token;
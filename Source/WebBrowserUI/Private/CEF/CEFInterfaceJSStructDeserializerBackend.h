@@ -149,6 +149,13 @@ public:
 	virtual void SkipArray() override;
 	virtual void SkipStructure() override;
 
+	/** Reads a single top level property directly from a list, without walking a dictionary. */
+#if UE_VERSION >= 425
+	static bool ReadArgument(TSharedPtr<FCEFInterfaceJSScripting> Scripting, FProperty* Property, void* Data, CefRefPtr<CefListValue> List, int32 Index);
+#else
+	static bool ReadArgument(TSharedPtr<FCEFInterfaceJSScripting> Scripting, UProperty* Property, void* Data, CefRefPtr<CefListValue> List, int32 Index);
+#endif
+
 private:
 	TSharedPtr<FCEFInterfaceJSScripting> Scripting;
 	/** Holds the source CEF dictionary containing a serialized verion of the structure. */
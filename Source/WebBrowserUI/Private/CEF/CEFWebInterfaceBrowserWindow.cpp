@@ -1770,6 +1770,58 @@ void FCEFWebInterfaceBrowserWindow::ExecuteJavascript(const FString& Script)
 	}
 }
 
+bool FCEFWebInterfaceBrowserWindow::CallJavascriptFunction(const FString& Function, const FWebInterfaceJSParam* Data)
+{
+	if (IsValid())
+	{
+		return Scripting->CallInterfaceFunction(Function, Data);
+	}
+	return false;
+}
+
+bool FCEFWebInterfaceBrowserWindow::CallJavascriptBatch(const FWebInterfaceJSParam& Calls)
+{
+	if (IsValid())
+	{
+		return Scripting->CallInterfaceFunctions(Calls);
+	}
+	return false;
+}
+
+void FCEFWebInterfaceBrowserWindow::ObserveUObject(const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame)
+{
+	Scripting->ObserveUObject(Name, Object, Properties, bEveryFrame);
+}
+
+void FCEFWebInterfaceBrowserWindow::UnobserveUObject(const FString& Name, UObject* Object)
+{
+	Scripting->UnobserveUObject(Name, Object);
+}
+
+void FCEFWebInterfaceBrowserWindow::MarkUObjectDirty(UObject* Object)
+{
+	Scripting->MarkUObjectDirty(Object);
+}
+
+void FCEFWebInterfaceBrowserWindow::SetUObjectAsyncMethods(UObject* Object, const TArray<FName>& Methods)
+{
+	Scripting->SetUObjectAsyncMethods(Object, Methods);
+}
+
+void FCEFWebInterfaceBrowserWindow::SetUObjectMemoized(UObject* Object, bool bMemoize)
+{
+	Scripting->SetUObjectMemoized(Object, bMemoize);
+}
+
+void FCEFWebInterfaceBrowserWindow::SetUObjectTypedArrays(UObject* Object, bool bTypedArrays)
+{
+	Scripting->SetUObjectTypedArrays(Object, bTypedArrays);
+}
+
+void FCEFWebInterfaceBrowserWindow::InvalidateUObject(UObject* Object)
+{
+	Scripting->InvalidateUObject(Object);
+}
 
 void FCEFWebInterfaceBrowserWindow::CloseBrowser(bool bForce, bool bBlockTillClosed)
 {
@@ -1937,9 +1989,17 @@ void FCEFWebInterfaceBrowserWindow::NotifyDocumentLoadingStateChange(bool IsLoad
 			SetIsHidden(false);
 		}
 
+		// Let the document attach to the dispatcher, so calls into ue.interface no longer need a script each
+		ExecuteJavascript(Scripting->GetDispatcherScript());
+
 		// Compatibility with Android script bindings: dispatch a custom ue:ready event when the document is fully loaded
 		ExecuteJavascript(TEXT("document.dispatchEvent(new CustomEvent('ue:ready', {details: window.ue}));"));
 	}
+	else
+	{
+		// The attached function goes away with the current document
+		Scripting->DetachDispatcher();
+	}
 
 	// Ignore a load completed notification if there was an error.
 	// For load started, reset any errors from previous page load.
@@ -152,6 +152,15 @@ public:
 	virtual void Reload() override;
 	virtual void StopLoad() override;
 	virtual void ExecuteJavascript(const FString& Script) override;
+	virtual bool CallJavascriptFunction(const FString& Function, const FWebInterfaceJSParam* Data) override;
+	virtual bool CallJavascriptBatch(const FWebInterfaceJSParam& Calls) override;
+	virtual void ObserveUObject(const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame) override;
+	virtual void UnobserveUObject(const FString& Name, UObject* Object = nullptr) override;
+	virtual void MarkUObjectDirty(UObject* Object) override;
+	virtual void SetUObjectAsyncMethods(UObject* Object, const TArray<FName>& Methods) override;
+	virtual void SetUObjectMemoized(UObject* Object, bool bMemoize) override;
+	virtual void SetUObjectTypedArrays(UObject* Object, bool bTypedArrays) override;
+	virtual void InvalidateUObject(UObject* Object) override;
 	virtual void CloseBrowser(bool bForce, bool bBlockTillClosed) override;
 	virtual void BindUObject(const FString& Name, UObject* Object, bool bIsPermanent = true) override;
 	virtual void UnbindUObject(const FString& Name, UObject* Object = nullptr, bool bIsPermanent = true) override;
@@ -6,12 +6,11 @@
 #include "IWebInterfaceBrowserWindow.h"
 #include "MobileInterfaceJSStructSerializerBackend.h"
 #include "MobileInterfaceJSStructDeserializerBackend.h"
+#include "WebInterfaceJSProfiler.h"
 #include "StructSerializer.h"
 #include "StructDeserializer.h"
 #include "UObject/UnrealType.h"
 #include "Async/Async.h"
-#include "Policies/CondensedJsonPrintPolicy.h"
-#include "JsonObjectConverter.h"
 
 // For UrlDecode/Encode
 #include "Http.h"
@@ -242,6 +241,17 @@ namespace
 				Writer->WriteObjectEnd();
 				break;
 			}
+			case FWebInterfaceJSParam::PTYPE_TYPED_ARRAY:
+			{
+				// Scripts are sent as text, so typed arrays are written as plain arrays
+				WriteArrayStart(Writer, Key);
+				for(int i=0; i < Param.TypedArrayValue->Num(); ++i)
+				{
+					Writer->WriteValue(Param.TypedArrayValue->GetValue(i));
+				}
+				Writer->WriteArrayEnd();
+				break;
+			}
 			default:
 				return false;
 		}
@@ -263,7 +273,7 @@ void FMobileInterfaceJSScripting::AddPermanentBind(const FString& Name, UObject*
 	{
 		return;
 	}
-	BoundObjects[Object] = { true, -1 };
+	MakeBindingPermanent(Object);
 	PermanentUObjectsByName.Add(ExposedName, Object);
 }
 
@@ -275,7 +285,7 @@ void FMobileInterfaceJSScripting::RemovePermanentBind(const FString& Name, UObje
 	if (PermanentUObjectsByName.Contains(ExposedName) && (Object == nullptr || PermanentUObjectsByName[ExposedName] == Object))
 	{
 		Object = PermanentUObjectsByName.FindAndRemoveChecked(ExposedName);
-		BoundObjects.Remove(Object);
+		RemoveBinding(Object);
 		return;
 	}
 	else
@@ -353,74 +363,77 @@ bool FMobileInterfaceJSScripting::OnJsMessageReceived(const FString& Command, co
 
 FString FMobileInterfaceJSScripting::ConvertStruct(UStruct* TypeInfo, const void* StructPtr)
 {
-	TSharedRef<FJsonObject> OutJson(new FJsonObject());
-	if (FJsonObjectConverter::UStructToJsonObject(TypeInfo, StructPtr, OutJson))
-	{
-		FString StringToFill;
-		auto Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&StringToFill);
-		if (FJsonSerializer::Serialize(OutJson, Writer))
-		{
-			return StringToFill;
-		}
-	}
-	return TEXT("undefined");
+	return StructWriter.Write(*this, TypeInfo, StructPtr, [this](UObject* Object) { return ConvertObject(Object); });
 }
 
 FString FMobileInterfaceJSScripting::ConvertObject(UObject* Object)
 {
-	RetainBinding(Object);
+	const int32 Slot = RetainBinding(Object);
 	UClass* Class = Object->GetClass();
 
-	bool first = true;
-	FString Result = TEXT("(function(){ return Object.create({");
-	for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::IncludeSuper); FunctionIt; ++FunctionIt)
+	const FString* Methods = ClassMethods.Find(Class);
+	if (Methods == nullptr)
 	{
-		UFunction* Function = *FunctionIt;
-		if(!first)
+		bool first = true;
+		FString NewMethods = TEXT("(function(){ return Object.create({");
+		for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::IncludeSuper); FunctionIt; ++FunctionIt)
 		{
-			Result.Append(TEXT(","));
-		}
-		else
-		{
-			first = false;
-		}
-		Result.Append(*GetBindingName(Function));
-		Result.Append(TEXT(": function "));
-		Result.Append(*GetBindingName(Function));
-		Result.Append(TEXT(" ("));
+			UFunction* Function = *FunctionIt;
+			if(!first)
+			{
+				NewMethods.Append(TEXT(","));
+			}
+			else
+			{
+				first = false;
+			}
+			NewMethods.Append(*GetBindingName(Function));
+			NewMethods.Append(TEXT(": function "));
+			NewMethods.Append(*GetBindingName(Function));
+			NewMethods.Append(TEXT(" ("));
 
-		bool firstArg = true;
-		for ( TFieldIterator<FProperty> It(Function); It; ++It )
-		{
-			FProperty* Param = *It;
-			if (Param->PropertyFlags & CPF_Parm && ! (Param->PropertyFlags & CPF_ReturnParm) )
+			bool firstArg = true;
+			for ( TFieldIterator<FProperty> It(Function); It; ++It )
 			{
-				FStructProperty *StructProperty = CastField<FStructProperty>(Param);
-				if (!StructProperty || !StructProperty->Struct->IsChildOf(FWebInterfaceJSResponse::StaticStruct()))
+				FProperty* Param = *It;
+				if (Param->PropertyFlags & CPF_Parm && ! (Param->PropertyFlags & CPF_ReturnParm) )
 				{
-					if(!firstArg)
-					{
-						Result.Append(TEXT(", "));
-					}
-					else
+					FStructProperty *StructProperty = CastField<FStructProperty>(Param);
+					if (!StructProperty || !StructProperty->Struct->IsChildOf(FWebInterfaceJSResponse::StaticStruct()))
 					{
-						firstArg = false;
+						if(!firstArg)
+						{
+							NewMethods.Append(TEXT(", "));
+						}
+						else
+						{
+							firstArg = false;
+						}
+						NewMethods.Append(*GetBindingName(Param));
 					}
-					Result.Append(*GetBindingName(Param));
 				}
 			}
-		}
 
-		Result.Append(TEXT(")"));
-		Result.Append(TEXT(" {return window.ue.$.executeMethod(this.$id, arguments)}"));
+			NewMethods.Append(TEXT(")"));
+			NewMethods.Append(TEXT(" {return window.ue.$.executeMethod(this.$id, arguments)}"));
+		}
+		NewMethods.Append(TEXT("},{"));
+		Methods = &ClassMethods.Add(Class, MoveTemp(NewMethods));
 	}
-	Result.Append(TEXT("},{"));
+
+	FString Result = *Methods;
 	Result.Append(TEXT("$id: {writable: false, configurable:false, enumerable: false, value: '"));
- 	Result.Append(*PtrToGuid(Object).ToString(EGuidFormats::Digits));
+ 	Result.Append(*GetObjectId(Slot));
 	Result.Append(TEXT("'}})})()"));
 	return Result;
 }
 
+void FMobileInterfaceJSScripting::FlushClassCaches()
+{
+	ClassMethods.Empty();
+	StructWriter.Flush();
+}
+
 void FMobileInterfaceJSScripting::InvokeJSFunction(FGuid FunctionId, int32 ArgCount, FWebInterfaceJSParam Arguments[], bool bIsError)
 {
 	TSharedPtr<IWebInterfaceBrowserWindow> Window = WindowPtr.Pin();
@@ -469,14 +482,14 @@ bool FMobileInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 	}
 
 	FGuid ObjectKey;
-	if (!FGuid::Parse(MessageArgs[0], ObjectKey))
+	if (!ParseId(MessageArgs[0], ObjectKey))
 	{
 		// Invalid GUID
 		return false;
 	}
 	// Get the promise callback and use that to report any results from executing this function.
 	FGuid ResultCallbackId;
-	if (!FGuid::Parse(MessageArgs[1], ResultCallbackId))
+	if (!ParseId(MessageArgs[1], ResultCallbackId))
 	{
 		// Invalid GUID
 		return false;
@@ -498,6 +511,14 @@ bool FMobileInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 		return true;
 	}
 
+	const bool bProfile = FWebInterfaceJSProfiler::IsEnabled();
+	const FName ProfileName = bProfile ? FName(*FString::Printf(TEXT("%s.%s"), *Object->GetClass()->GetName(), *MethodName.ToString())) : NAME_None;
+	const double StartTime = FPlatformTime::Seconds();
+	if (bProfile)
+	{
+		FWebInterfaceJSProfiler::AddCall(ProfileName, MessageArgs[3].Len());
+	}
+
 	// Coerce arguments to function arguments.
 	uint16 ParamsSize = Function->ParmsSize;
 	TArray<uint8> Params;
@@ -506,6 +527,8 @@ bool FMobileInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 
 	if (ParamsSize > 0)
 	{
+		WEBUI_BRIDGE_SCOPE(Decode, ProfileName);
+
 		// Find return parameter and a promise argument if present, as we need to handle them differently
 		for ( TFieldIterator<FProperty> It(Function); It; ++It )
 		{
@@ -548,11 +571,16 @@ bool FMobileInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 		}
 	}
 
-	Object->ProcessEvent(Function, Params.GetData());
+	{
+		WEBUI_BRIDGE_SCOPE(Process, ProfileName);
+		Object->ProcessEvent(Function, Params.GetData());
+	}
 	if ( ! PromiseParam ) // If PromiseParam is set, we assume that the UFunction will ensure it is called with the result
 	{
 		if ( ReturnParam )
 		{
+			WEBUI_BRIDGE_SCOPE(Encode, ProfileName);
+
 			FStructSerializerPolicies ReturnPolicies;
 			ReturnPolicies.PropertyFilter = [&](const FProperty* CandidateProperty, const FProperty* ParentProperty)
 			{
@@ -568,6 +596,10 @@ bool FMobileInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 			ResultJS.Append(GetBindingName(ReturnParam).ReplaceCharWithEscapedChar());
 			ResultJS.Append(TEXT("']"));
 			*/
+			if (bProfile)
+			{
+				FWebInterfaceJSProfiler::AddResult(ProfileName, ResultJS.Len(), FPlatformTime::Seconds() - StartTime);
+			}
 			InvokeJSFunctionRaw(ResultCallbackId, ResultJS, false);
 		}
 		else
@@ -625,6 +657,7 @@ void FMobileInterfaceJSScripting::PageLoaded(TSharedRef<class IWebInterfaceBrows
 	{
 		if (!It->Value.bIsPermanent)
 		{
+			FreeObjectSlot(It->Value.Slot);
 			It.RemoveCurrent();
 		}
 	}
@@ -7,6 +7,7 @@
 
 #include "WebInterfaceJSFunction.h"
 #include "WebInterfaceJSScripting.h"
+#include "WebInterfaceJSStructWriter.h"
 
 typedef TSharedRef<class FMobileInterfaceJSScripting> FMobileInterfaceJSScriptingRef;
 typedef TSharedPtr<class FMobileInterfaceJSScripting> FMobileInterfaceJSScriptingPtr;
@@ -47,6 +48,9 @@ public:
 
 	void SetWindow(TSharedRef<class IWebInterfaceBrowserWindow> InWindow);
 
+protected:
+	virtual void FlushClassCaches() override;
+
 private:
 	void InitializeScript(TSharedRef<class IWebInterfaceBrowserWindow> InWindow);
 	void InvokeJSFunctionRaw(FGuid FunctionId, const FString& JSValue, bool bIsError=false);
@@ -63,6 +67,12 @@ private:
 
 	/** Pointer to the Mobile Browser for this window. */
 	TWeakPtr<class IWebInterfaceBrowserWindow> WindowPtr;
+
+	/** The methods part of converted objects, by class. */
+	TMap<UClass*, FString> ClassMethods;
+
+	/** Writes converted structs. */
+	FWebInterfaceJSStructWriter StructWriter;
 };
 
 #endif // PLATFORM_ANDROID  || PLATFORM_IOS
\ No newline at end of file
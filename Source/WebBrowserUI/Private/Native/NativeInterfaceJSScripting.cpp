@@ -4,6 +4,7 @@
 
 #include "NativeInterfaceJSStructSerializerBackend.h"
 #include "NativeInterfaceJSStructDeserializerBackend.h"
+#include "WebInterfaceJSProfiler.h"
 #include "StructSerializer.h"
 #include "StructDeserializer.h"
 #include "UObject/UnrealType.h"
@@ -115,6 +116,17 @@ namespace NativeInterfaceFuncs
 				Writer->WriteObjectEnd();
 				break;
 			}
+			case FWebInterfaceJSParam::PTYPE_TYPED_ARRAY:
+			{
+				// Scripts are sent as text, so typed arrays are written as plain arrays
+				WriteArrayStart(Writer, Key);
+				for(int i=0; i < Param.TypedArrayValue->Num(); ++i)
+				{
+					Writer->WriteValue(Param.TypedArrayValue->GetValue(i));
+				}
+				Writer->WriteArrayEnd();
+				break;
+			}
 			default:
 				return false;
 		}
@@ -141,7 +153,7 @@ void FNativeInterfaceJSScripting::BindUObject(const FString& Name, UObject* Obje
 			return;
 		}
 
-		BoundObjects[Object]={true, -1};
+		MakeBindingPermanent(Object);
 		PermanentUObjectsByName.Add(ExposedName, Object);
 	}
 	
@@ -176,7 +188,7 @@ void FNativeInterfaceJSScripting::UnbindUObject(const FString& Name, UObject* Ob
 		if (PermanentUObjectsByName.Contains(ExposedName) && (Object == nullptr || PermanentUObjectsByName[ExposedName] == Object))
 		{
 			Object = PermanentUObjectsByName.FindAndRemoveChecked(ExposedName);
-			BoundObjects.Remove(Object);
+			RemoveBinding(Object);
 			return;
 		}
 		else
@@ -238,99 +250,96 @@ bool FNativeInterfaceJSScripting::OnJsMessageReceived(const FString& Message)
 
 FString FNativeInterfaceJSScripting::ConvertStruct(UStruct* TypeInfo, const void* StructPtr)
 {
-	TArray<uint8> ReturnBuffer;
-	FMemoryWriter Writer(ReturnBuffer);
-
-	FNativeInterfaceJSStructSerializerBackend ReturnBackend = FNativeInterfaceJSStructSerializerBackend(SharedThis(this), Writer);
-	FStructSerializer::Serialize(StructPtr, *TypeInfo, ReturnBackend);
-
-	// Extract the result value from the serialized JSON object:
-	ReturnBuffer.Add(0);
-	ReturnBuffer.Add(0); // Add two as we're dealing with UTF-16, so 2 bytes
-
-#if UE_VERSION >= 424
-	return UTF16_TO_TCHAR((UTF16CHAR*)ReturnBuffer.GetData());
-#else
-	auto CastObject = StringCast<TCHAR>((UCS2CHAR*)ReturnBuffer.GetData());
-	FString ResultJS = FString(CastObject.Get(), CastObject.Length());
-	return ResultJS;
-#endif
+	return StructWriter.Write(*this, TypeInfo, StructPtr, [this](UObject* Object) { return ConvertObject(Object); });
 }
 
 FString FNativeInterfaceJSScripting::ConvertObject(UObject* Object)
 {
-	RetainBinding(Object);
+	const int32 Slot = RetainBinding(Object);
 	UClass* Class = Object->GetClass();
 
-	bool first = true;
-	FString Result = TEXT("(function(){ return Object.create({");
-	for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::IncludeSuper); FunctionIt; ++FunctionIt)
+	const FString* Methods = ClassMethods.Find(Class);
+	if (Methods == nullptr)
 	{
-		UFunction* Function = *FunctionIt;
-		if(!first)
+		bool first = true;
+		FString NewMethods = TEXT("(function(){ return Object.create({");
+		for (TFieldIterator<UFunction> FunctionIt(Class, EFieldIteratorFlags::IncludeSuper); FunctionIt; ++FunctionIt)
 		{
-			Result.Append(TEXT(","));
-		}
-		else
-		{
-			first = false;
-		}
-		Result.Append(*GetBindingName(Function));
-		Result.Append(TEXT(": function "));
-		Result.Append(*GetBindingName(Function));
-		Result.Append(TEXT(" ("));
+			UFunction* Function = *FunctionIt;
+			if(!first)
+			{
+				NewMethods.Append(TEXT(","));
+			}
+			else
+			{
+				first = false;
+			}
+			NewMethods.Append(*GetBindingName(Function));
+			NewMethods.Append(TEXT(": function "));
+			NewMethods.Append(*GetBindingName(Function));
+			NewMethods.Append(TEXT(" ("));
 
-		bool firstArg = true;
+			bool firstArg = true;
 #if UE_VERSION >= 425
-		for ( TFieldIterator<FProperty> It(Function); It; ++It )
+			for ( TFieldIterator<FProperty> It(Function); It; ++It )
 #else
-		for ( TFieldIterator<UProperty> It(Function); It; ++It )
+			for ( TFieldIterator<UProperty> It(Function); It; ++It )
 #endif
-		{
+			{
 #if UE_VERSION >= 425
-			FProperty* Param = *It;
+				FProperty* Param = *It;
 #else
-			UProperty* Param = *It;
+				UProperty* Param = *It;
 #endif
 
-			if (Param->PropertyFlags & CPF_Parm && ! (Param->PropertyFlags & CPF_ReturnParm) )
-			{
+				if (Param->PropertyFlags & CPF_Parm && ! (Param->PropertyFlags & CPF_ReturnParm) )
+				{
 #if UE_VERSION >= 425
-				FStructProperty *StructProperty = CastField<FStructProperty>(Param);
+					FStructProperty *StructProperty = CastField<FStructProperty>(Param);
 #else
-				UStructProperty *StructProperty = Cast<UStructProperty>(Param);
+					UStructProperty *StructProperty = Cast<UStructProperty>(Param);
 #endif
-				if (!StructProperty || !StructProperty->Struct->IsChildOf(FWebInterfaceJSResponse::StaticStruct()))
-				{
-					if(!firstArg)
-					{
-						Result.Append(TEXT(", "));
-					}
-					else
+					if (!StructProperty || !StructProperty->Struct->IsChildOf(FWebInterfaceJSResponse::StaticStruct()))
 					{
-						firstArg = false;
+						if(!firstArg)
+						{
+							NewMethods.Append(TEXT(", "));
+						}
+						else
+						{
+							firstArg = false;
+						}
+						NewMethods.Append(*GetBindingName(Param));
 					}
-					Result.Append(*GetBindingName(Param));
 				}
 			}
-		}
 
-		Result.Append(TEXT(")"));
+			NewMethods.Append(TEXT(")"));
 
-		// We hijack the RPCResponseId and use it for our priority value.  0 means it has not been assigned and we default to 2.  1-5 is high-low priority which we map to the 0-4 range used by EmbeddedCommunication.
-		int32 Priority = Function->RPCResponseId == 0 ? 2 : FMath::Clamp((int32)Function->RPCResponseId, 1, 5) - 1;
+			// We hijack the RPCResponseId and use it for our priority value.  0 means it has not been assigned and we default to 2.  1-5 is high-low priority which we map to the 0-4 range used by EmbeddedCommunication.
+			int32 Priority = Function->RPCResponseId == 0 ? 2 : FMath::Clamp((int32)Function->RPCResponseId, 1, 5) - 1;
 
-		Result.Append(TEXT(" {return window.ue.$.executeMethod('"));
-		Result.Append(FString::FromInt(Priority));
-		Result.Append(TEXT("',this.$id, arguments)}"));
+			NewMethods.Append(TEXT(" {return window.ue.$.executeMethod('"));
+			NewMethods.Append(FString::FromInt(Priority));
+			NewMethods.Append(TEXT("',this.$id, arguments)}"));
+		}
+		NewMethods.Append(TEXT("},{"));
+		Methods = &ClassMethods.Add(Class, MoveTemp(NewMethods));
 	}
-	Result.Append(TEXT("},{"));
+
+	FString Result = *Methods;
 	Result.Append(TEXT("$id: {writable: false, configurable:false, enumerable: false, value: '"));
- 	Result.Append(*PtrToGuid(Object).ToString(EGuidFormats::Digits));
+ 	Result.Append(*GetObjectId(Slot));
 	Result.Append(TEXT("'}})})()"));
 	return Result;
 }
 
+void FNativeInterfaceJSScripting::FlushClassCaches()
+{
+	ClassMethods.Empty();
+	StructWriter.Flush();
+}
+
 void FNativeInterfaceJSScripting::InvokeJSFunction(FGuid FunctionId, int32 ArgCount, FWebInterfaceJSParam Arguments[], bool bIsError)
 {
 	if (!IsValid())
@@ -385,7 +394,7 @@ bool FNativeInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 	const FString& ObjectIdStr = MessageArgs[0];
 	FGuid ObjectKey;
 	UObject* Object = nullptr;
-	if (FGuid::Parse(ObjectIdStr, ObjectKey))
+	if (ParseId(ObjectIdStr, ObjectKey))
 	{
 		Object = GuidToPtr(ObjectKey);
 	}
@@ -402,7 +411,7 @@ bool FNativeInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 	
 	// Get the promise callback and use that to report any results from executing this function.
 	FGuid ResultCallbackId;
-	if (!FGuid::Parse(MessageArgs[1], ResultCallbackId))
+	if (!ParseId(MessageArgs[1], ResultCallbackId))
 	{
 		// Invalid GUID
 		return false;
@@ -416,6 +425,14 @@ bool FNativeInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 		return true;
 	}
 
+	const bool bProfile = FWebInterfaceJSProfiler::IsEnabled();
+	const FName ProfileName = bProfile ? FName(*FString::Printf(TEXT("%s.%s"), *Object->GetClass()->GetName(), *MethodName.ToString())) : NAME_None;
+	const double StartTime = FPlatformTime::Seconds();
+	if (bProfile)
+	{
+		FWebInterfaceJSProfiler::AddCall(ProfileName, MessageArgs[3].Len());
+	}
+
 	// Coerce arguments to function arguments.
 	uint16 ParamsSize = Function->ParmsSize;
 	TArray<uint8> Params;
@@ -430,6 +447,8 @@ bool FNativeInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 
 	if (ParamsSize > 0)
 	{
+		WEBUI_BRIDGE_SCOPE(Decode, ProfileName);
+
 		// Find return parameter and a promise argument if present, as we need to handle them differently
 #if UE_VERSION >= 425
 		for ( TFieldIterator<FProperty> It(Function); It; ++It )
@@ -499,11 +518,16 @@ bool FNativeInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 		}
 	}
 
-	Object->ProcessEvent(Function, Params.GetData());
+	{
+		WEBUI_BRIDGE_SCOPE(Process, ProfileName);
+		Object->ProcessEvent(Function, Params.GetData());
+	}
 	if ( ! PromiseParam ) // If PromiseParam is set, we assume that the UFunction will ensure it is called with the result
 	{
 		if ( ReturnParam )
 		{
+			WEBUI_BRIDGE_SCOPE(Encode, ProfileName);
+
 			FStructSerializerPolicies ReturnPolicies;
 #if UE_VERSION >= 425
 			ReturnPolicies.PropertyFilter = [&ReturnParam](const FProperty* CandidateProperty, const FProperty* ParentProperty)
@@ -530,6 +554,10 @@ bool FNativeInterfaceJSScripting::HandleExecuteUObjectMethodMessage(const TArray
 			FString ResultJS = FString(CastObject.Get(), CastObject.Length());
 #endif
 
+			if (bProfile)
+			{
+				FWebInterfaceJSProfiler::AddResult(ProfileName, ResultJS.Len(), FPlatformTime::Seconds() - StartTime);
+			}
 			InvokeJSFunctionRaw(ResultCallbackId, ResultJS, false);
 		}
 		else
@@ -679,6 +707,7 @@ void FNativeInterfaceJSScripting::PageLoaded()
 	{
 		if (!It->Value.bIsPermanent)
 		{
+			FreeObjectSlot(It->Value.Slot);
 			It.RemoveCurrent();
 		}
 	}
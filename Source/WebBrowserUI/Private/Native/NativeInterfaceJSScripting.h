@@ -5,6 +5,7 @@
 
 #include "WebInterfaceJSFunction.h"
 #include "WebInterfaceJSScripting.h"
+#include "WebInterfaceJSStructWriter.h"
 
 typedef TSharedRef<class FNativeInterfaceJSScripting> FNativeInterfaceJSScriptingRef;
 typedef TSharedPtr<class FNativeInterfaceJSScripting> FNativeInterfaceJSScriptingPtr;
@@ -35,6 +36,9 @@ public:
 	virtual void InvokeJSErrorResult(FGuid FunctionId, const FString& Error) override;
 	void PageLoaded();
 
+protected:
+	virtual void FlushClassCaches() override;
+
 private:
 	FString GetInitializeScript();
 	void InvokeJSFunctionRaw(FGuid FunctionId, const FString& JSValue, bool bIsError=false);
@@ -49,4 +53,10 @@ private:
 
 	TWeakPtr<FNativeWebInterfaceBrowserProxy> WindowPtr;
 	bool bLoaded;
+
+	/** The methods part of converted objects, by class. */
+	TMap<UClass*, FString> ClassMethods;
+
+	/** Writes converted structs. */
+	FWebInterfaceJSStructWriter StructWriter;
 };
@@ -592,6 +592,80 @@ void SWebInterfaceBrowserView::ExecuteJavascript(const FString& ScriptText)
 	}
 }
 
+bool SWebInterfaceBrowserView::CallJavascriptFunction(const FString& Function, const FWebInterfaceJSParam* Data)
+{
+	if (BrowserWindow.IsValid())
+	{
+		return BrowserWindow->CallJavascriptFunction(Function, Data);
+	}
+	return false;
+}
+
+bool SWebInterfaceBrowserView::CallJavascriptBatch(const FWebInterfaceJSParam& Calls)
+{
+	if (BrowserWindow.IsValid())
+	{
+		return BrowserWindow->CallJavascriptBatch(Calls);
+	}
+	return false;
+}
+
+void SWebInterfaceBrowserView::ObserveUObject(const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame)
+{
+	if (BrowserWindow.IsValid())
+	{
+		BrowserWindow->ObserveUObject(Name, Object, Properties, bEveryFrame);
+	}
+}
+
+void SWebInterfaceBrowserView::UnobserveUObject(const FString& Name, UObject* Object)
+{
+	if (BrowserWindow.IsValid())
+	{
+		BrowserWindow->UnobserveUObject(Name, Object);
+	}
+}
+
+void SWebInterfaceBrowserView::MarkUObjectDirty(UObject* Object)
+{
+	if (BrowserWindow.IsValid())
+	{
+		BrowserWindow->MarkUObjectDirty(Object);
+	}
+}
+
+void SWebInterfaceBrowserView::SetUObjectAsyncMethods(UObject* Object, const TArray<FName>& Methods)
+{
+	if (BrowserWindow.IsValid())
+	{
+		BrowserWindow->SetUObjectAsyncMethods(Object, Methods);
+	}
+}
+
+void SWebInterfaceBrowserView::SetUObjectMemoized(UObject* Object, bool bMemoize)
+{
+	if (BrowserWindow.IsValid())
+	{
+		BrowserWindow->SetUObjectMemoized(Object, bMemoize);
+	}
+}
+
+void SWebInterfaceBrowserView::SetUObjectTypedArrays(UObject* Object, bool bTypedArrays)
+{
+	if (BrowserWindow.IsValid())
+	{
+		BrowserWindow->SetUObjectTypedArrays(Object, bTypedArrays);
+	}
+}
+
+void SWebInterfaceBrowserView::InvalidateUObject(UObject* Object)
+{
+	if (BrowserWindow.IsValid())
+	{
+		BrowserWindow->InvalidateUObject(Object);
+	}
+}
+
 void SWebInterfaceBrowserView::GetSource(TFunction<void (const FString&)> Callback) const
 {
 	if (BrowserWindow.IsValid())
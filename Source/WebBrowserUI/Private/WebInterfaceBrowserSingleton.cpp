@@ -777,6 +777,9 @@ bool FWebInterfaceBrowserSingleton::Tick(float DeltaTime)
 {
     QUICK_SCOPE_CYCLE_COUNTER(STAT_FWebInterfaceBrowserSingleton_Tick);
 
+	// Flush work that was batched during the frame, so it is sent with this pump
+	PreTickEvent.Broadcast();
+
 #if WITH_CEF3
 	if (bAllowCEF)
 	{
@@ -145,6 +145,11 @@ public:
 		return DefaultTranslucentMaterial;
 	}
 
+	virtual FSimpleMulticastDelegate& OnPreTick() override
+	{
+		return PreTickEvent;
+	}
+
 public:
 
 	// FTSTickerObjectBase Interface
@@ -206,6 +211,9 @@ private:
 	/** Reference to UWebBrowser's translucent material*/
 	UMaterialInterface* DefaultTranslucentMaterial;
 
+	/** Broadcast at the start of each tick, before the message pump. */
+	FSimpleMulticastDelegate PreTickEvent;
+
 };
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
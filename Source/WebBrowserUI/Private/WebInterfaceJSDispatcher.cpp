@@ -0,0 +1,65 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "WebInterfaceJSDispatcher.h"
+
+#if UE_VERSION >= 501
+#include UE_INLINE_GENERATED_CPP_BY_NAME(WebInterfaceJSDispatcher)
+#endif
+
+void UWebInterfaceJSDispatcher::Attach(FWebInterfaceJSFunction Function)
+{
+	Dispatcher = Function;
+}
+
+void UWebInterfaceJSDispatcher::Batch()
+{
+	// handled by the scripting layer
+}
+
+void UWebInterfaceJSDispatcher::Detach()
+{
+	Dispatcher = FWebInterfaceJSFunction();
+}
+
+bool UWebInterfaceJSDispatcher::IsAttached() const
+{
+	return Dispatcher.IsValid();
+}
+
+FGuid UWebInterfaceJSDispatcher::GetFunctionId() const
+{
+	return Dispatcher.GetCallbackId();
+}
+
+bool UWebInterfaceJSDispatcher::Call(const FString& Name, const FWebInterfaceJSParam* Data) const
+{
+	if (!Dispatcher.IsValid())
+	{
+		return false;
+	}
+
+	if (Data && Data->HasTypedArray())
+	{
+		Dispatcher(Name, *Data, true);
+	}
+	else if (Data)
+	{
+		Dispatcher(Name, *Data);
+	}
+	else
+	{
+		Dispatcher(Name);
+	}
+
+	return true;
+}
+
+bool UWebInterfaceJSDispatcher::CallBatch(const FWebInterfaceJSParam& Calls) const
+{
+	if (!Dispatcher.IsValid())
+	{
+		return false;
+	}
+
+	Dispatcher(Calls);
+	return true;
+}
@@ -0,0 +1,62 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "WebInterfaceJSFunction.h"
+#include "WebInterfaceJSDispatcher.generated.h"
+
+/**
+ * Holds a page side function that forwards calls to ue.interface.
+ * Calls made through it are sent as native values, so the renderer doesn't have to compile a script for every call.
+ */
+UCLASS()
+class UWebInterfaceJSDispatcher : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Called from the page once it has loaded, with the function that forwards calls. */
+	UFUNCTION()
+	void Attach(FWebInterfaceJSFunction Function);
+
+	/**
+	 * Called from the page with a list of [object, method, arguments] calls gathered by ue.$batch.
+	 * FCEFInterfaceJSScripting handles this before it reaches the object, so the calls are read straight from the message.
+	 */
+	UFUNCTION()
+	void Batch();
+
+	/** Forget the current function, it is no longer valid once the page navigates away. */
+	void Detach();
+
+	/** Whether a page function is attached. */
+	bool IsAttached() const;
+
+	/** The id of the attached page function, for scripting layers that build the call message themselves. */
+	FGuid GetFunctionId() const;
+
+	/**
+	 * Call ue.interface[Name] through the attached function.
+	 *
+	 * @param Name The name of the function on ue.interface.
+	 * @param Data The argument to pass, or nullptr to call it without arguments.
+	 * @return false if no page function is attached.
+	 *
+	 * Typed arrays in the argument are restored on the page before ue.interface[Name] is called.
+	 */
+	bool Call(const FString& Name, const FWebInterfaceJSParam* Data) const;
+
+	/**
+	 * Call several ue.interface functions in order, with a single message.
+	 *
+	 * @param Calls An array of [name, data, typed] arrays, where data is left out to call without arguments, and typed is set if data has typed arrays.
+	 * @return false if no page function is attached.
+	 */
+	bool CallBatch(const FWebInterfaceJSParam& Calls) const;
+
+private:
+
+	FWebInterfaceJSFunction Dispatcher;
+};
@@ -1,6 +1,7 @@
 // Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
 #include "WebInterfaceJSFunction.h"
 #include "WebInterfaceJSScripting.h"
+#include "Async/Async.h"
 
 #if UE_VERSION >= 501
 #include UE_INLINE_GENERATED_CPP_BY_NAME(WebInterfaceJSFunction)
@@ -49,6 +50,9 @@ FWebInterfaceJSParam::~FWebInterfaceJSParam()
 		case PTYPE_MAP:
 			delete MapValue;
 			break;
+		case PTYPE_TYPED_ARRAY:
+			delete TypedArrayValue;
+			break;
 		default:
 			break;
 	}
@@ -85,6 +89,9 @@ FWebInterfaceJSParam::FWebInterfaceJSParam(const FWebInterfaceJSParam& Other)
 		case PTYPE_MAP:
 			MapValue = new TMap<FString, FWebInterfaceJSParam>(*Other.MapValue);
 			break;
+		case PTYPE_TYPED_ARRAY:
+			TypedArrayValue = new FTypedArray(*Other.TypedArrayValue);
+			break;
 	}
 }
 
@@ -124,16 +131,193 @@ FWebInterfaceJSParam::FWebInterfaceJSParam(FWebInterfaceJSParam&& Other)
 		MapValue = Other.MapValue;
 		Other.MapValue = nullptr;
 		break;
+	case PTYPE_TYPED_ARRAY:
+		TypedArrayValue = Other.TypedArrayValue;
+		Other.TypedArrayValue = nullptr;
+		break;
 	}
 
 	Other.Tag = PTYPE_NULL;
 }
 
+namespace
+{
+	template <typename T>
+	void CopyTypedArray(FWebInterfaceJSParam::FTypedArray& TypedArray, const TArray<T>& Value)
+	{
+		TypedArray.Data.SetNumUninitialized(Value.Num() * sizeof(T));
+		FMemory::Memcpy(TypedArray.Data.GetData(), Value.GetData(), TypedArray.Data.Num());
+	}
+}
+
+FWebInterfaceJSParam::FTypedArray::FTypedArray(const TArray<float>& Value)
+	: Type(Float32)
+{
+	CopyTypedArray(*this, Value);
+}
+
+FWebInterfaceJSParam::FTypedArray::FTypedArray(const TArray<int32>& Value)
+	: Type(Int32)
+{
+	CopyTypedArray(*this, Value);
+}
+
+FWebInterfaceJSParam::FTypedArray::FTypedArray(const TArray<uint8>& Value)
+	: Type(Uint8)
+{
+	CopyTypedArray(*this, Value);
+}
+
+FWebInterfaceJSParam::FTypedArray::FTypedArray(const TArray<FVector>& Value)
+	: Type(Float32)
+{
+	Data.SetNumUninitialized(Value.Num() * 3 * sizeof(float));
+
+	float* Floats = (float*)Data.GetData();
+	for (const FVector& Item : Value)
+	{
+		*Floats++ = (float)Item.X;
+		*Floats++ = (float)Item.Y;
+		*Floats++ = (float)Item.Z;
+	}
+}
+
+bool FWebInterfaceJSParam::HasTypedArray() const
+{
+	switch (Tag)
+	{
+		case PTYPE_TYPED_ARRAY:
+			return true;
+		case PTYPE_ARRAY:
+			for (const FWebInterfaceJSParam& Item : *ArrayValue)
+			{
+				if (Item.HasTypedArray())
+				{
+					return true;
+				}
+			}
+			return false;
+		case PTYPE_MAP:
+			for (const TPair<FString, FWebInterfaceJSParam>& Pair : *MapValue)
+			{
+				if (Pair.Value.HasTypedArray())
+				{
+					return true;
+				}
+			}
+			return false;
+		default:
+			return false;
+	}
+}
+
+int32 FWebInterfaceJSParam::FTypedArray::Num() const
+{
+	switch (Type)
+	{
+		case Float32:
+			return Data.Num() / sizeof(float);
+		case Int32:
+			return Data.Num() / sizeof(int32);
+		default:
+			return Data.Num();
+	}
+}
+
+double FWebInterfaceJSParam::FTypedArray::GetValue(int32 Index) const
+{
+	switch (Type)
+	{
+		case Float32:
+			return ((const float*)Data.GetData())[Index];
+		case Int32:
+			return ((const int32*)Data.GetData())[Index];
+		default:
+			return Data[Index];
+	}
+}
+
+const TCHAR* FWebInterfaceJSParam::FTypedArray::GetTypeName() const
+{
+	switch (Type)
+	{
+		case Float32:
+			return TEXT("Float32");
+		case Int32:
+			return TEXT("Int32");
+		default:
+			return TEXT("Uint8");
+	}
+}
+
+bool FWebInterfaceJSParam::FTypedArray::FindType(const FString& Name, EType& OutType)
+{
+	if (Name == TEXT("Float32"))
+	{
+		OutType = Float32;
+	}
+	else if (Name == TEXT("Int32"))
+	{
+		OutType = Int32;
+	}
+	else if (Name == TEXT("Uint8"))
+	{
+		OutType = Uint8;
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+TMap<const UScriptStruct*, FWebInterfaceJSStructReader::FReader>& FWebInterfaceJSStructReader::GetReaders()
+{
+	static TMap<const UScriptStruct*, FReader> Readers;
+	return Readers;
+}
+
+void FWebInterfaceJSStructReader::Register(const UScriptStruct* Struct, FReader Reader)
+{
+	check(IsInGameThread());
+	GetReaders().Add(Struct, MoveTemp(Reader));
+}
+
+void FWebInterfaceJSStructReader::Unregister(const UScriptStruct* Struct)
+{
+	check(IsInGameThread());
+	GetReaders().Remove(Struct);
+}
+
+const FWebInterfaceJSStructReader::FReader* FWebInterfaceJSStructReader::Find(const UScriptStruct* Struct)
+{
+	return GetReaders().Find(Struct);
+}
+
 void FWebInterfaceJSCallbackBase::Invoke(int32 ArgCount, FWebInterfaceJSParam Arguments[], bool bIsError) const
 {
+	// Methods run on a worker thread may respond from there, the page is only called from the game thread
+	// Only the id is taken along, ScriptingPtr isn't thread safe and is looked up again from the id on the game thread
+	if (!IsInGameThread())
+	{
+		TArray<FWebInterfaceJSParam> ArgumentArray(Arguments, ArgCount);
+		AsyncTask(ENamedThreads::GameThread, [CallbackId = CallbackId, ArgumentArray = MoveTemp(ArgumentArray), bIsError]() mutable
+		{
+			TSharedPtr<FWebInterfaceJSScripting> Scripting = FWebInterfaceJSScripting::RemoveWorkerCallback(CallbackId);
+			if (Scripting.IsValid())
+			{
+				Scripting->InvokeJSFunction(CallbackId, ArgumentArray.Num(), ArgumentArray.GetData(), bIsError);
+			}
+		});
+		return;
+	}
+
 	TSharedPtr<FWebInterfaceJSScripting> Scripting = ScriptingPtr.Pin();
 	if (Scripting.IsValid())
 	{
+		// Responses of worker methods can also be resolved here
+		FWebInterfaceJSScripting::RemoveWorkerCallback(CallbackId);
 		Scripting->InvokeJSFunction(CallbackId, ArgCount, Arguments, bIsError);
 	}
 }
@@ -0,0 +1,167 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "WebInterfaceJSProfiler.h"
+#include "WebInterfaceBrowserLog.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_STAT(STAT_WebUIBridgeDecode);
+DEFINE_STAT(STAT_WebUIBridgeProcess);
+DEFINE_STAT(STAT_WebUIBridgeEncode);
+DEFINE_STAT(STAT_WebUIBridgeEvent);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Calls"), STAT_WebUIBridgeCalls, STATGROUP_WebUIBridge);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Events"), STAT_WebUIBridgeEvents, STATGROUP_WebUIBridge);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Argument Bytes"), STAT_WebUIBridgeArgumentBytes, STATGROUP_WebUIBridge);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Result Bytes"), STAT_WebUIBridgeResultBytes, STATGROUP_WebUIBridge);
+
+namespace
+{
+	bool bProfileBridge = false;
+	FAutoConsoleVariableRef CVarProfileBridge(
+		TEXT("WebUI.Bridge.Profile"),
+		bProfileBridge,
+		TEXT("Records calls between web interfaces and the engine, see WebUI.Bridge.Dump\n"),
+		ECVF_Default);
+
+	struct FProfileRecord
+	{
+		bool bEvent = false;
+
+		int64 Calls = 0;
+		int64 ArgumentBytes = 0;
+		int64 ResultBytes = 0;
+		uint64 Cycles[(int32)FWebInterfaceJSProfiler::EPhase::Num] = {};
+
+		int64 Results = 0;
+		double Latency = 0.0;
+		double MaxLatency = 0.0;
+
+		uint64 GetCycles() const
+		{
+			uint64 Total = 0;
+			for (uint64 PhaseCycles : Cycles)
+			{
+				Total += PhaseCycles;
+			}
+			return Total;
+		}
+	};
+
+	TMap<FName, FProfileRecord>& GetRecords()
+	{
+		static TMap<FName, FProfileRecord> Records;
+		return Records;
+	}
+
+	FAutoConsoleCommand CmdDumpBridge(
+		TEXT("WebUI.Bridge.Dump"),
+		TEXT("Logs the bridge calls and events that cost the most: WebUI.Bridge.Dump [Count] [Calls|Time|Bytes|Latency]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FWebInterfaceJSProfiler::Dump(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10, Args.Num() > 1 ? Args[1] : FString());
+		}));
+
+	FAutoConsoleCommand CmdResetBridge(
+		TEXT("WebUI.Bridge.Reset"),
+		TEXT("Forgets the recorded bridge calls and events"),
+		FConsoleCommandDelegate::CreateStatic(&FWebInterfaceJSProfiler::Reset));
+}
+
+bool FWebInterfaceJSProfiler::IsEnabled()
+{
+	return bProfileBridge;
+}
+
+void FWebInterfaceJSProfiler::AddCall(FName Name, int32 ArgumentBytes)
+{
+	INC_DWORD_STAT(STAT_WebUIBridgeCalls);
+	INC_DWORD_STAT_BY(STAT_WebUIBridgeArgumentBytes, ArgumentBytes);
+
+	FProfileRecord& Record = GetRecords().FindOrAdd(Name);
+	Record.Calls++;
+	Record.ArgumentBytes += ArgumentBytes;
+}
+
+void FWebInterfaceJSProfiler::AddEvent(FName Name, int32 DataBytes)
+{
+	INC_DWORD_STAT(STAT_WebUIBridgeEvents);
+	INC_DWORD_STAT_BY(STAT_WebUIBridgeArgumentBytes, DataBytes);
+
+	FProfileRecord& Record = GetRecords().FindOrAdd(Name);
+	Record.bEvent = true;
+	Record.Calls++;
+	Record.ArgumentBytes += DataBytes;
+}
+
+void FWebInterfaceJSProfiler::AddTime(FName Name, EPhase Phase, uint64 Cycles)
+{
+	GetRecords().FindOrAdd(Name).Cycles[(int32)Phase] += Cycles;
+}
+
+void FWebInterfaceJSProfiler::AddResult(FName Name, int32 ResultBytes, double Latency)
+{
+	INC_DWORD_STAT_BY(STAT_WebUIBridgeResultBytes, ResultBytes);
+
+	FProfileRecord& Record = GetRecords().FindOrAdd(Name);
+	Record.Results++;
+	Record.ResultBytes += ResultBytes;
+	Record.Latency += Latency;
+	Record.MaxLatency = FMath::Max(Record.MaxLatency, Latency);
+}
+
+void FWebInterfaceJSProfiler::Dump(int32 Count, const FString& SortBy)
+{
+	TArray<TPair<FName, const FProfileRecord*>> Sorted;
+	for (const TPair<FName, FProfileRecord>& Pair : GetRecords())
+	{
+		Sorted.Add(TPair<FName, const FProfileRecord*>(Pair.Key, &Pair.Value));
+	}
+
+	if (SortBy == TEXT("Calls"))
+	{
+		Sorted.Sort([](const TPair<FName, const FProfileRecord*>& A, const TPair<FName, const FProfileRecord*>& B) { return A.Value->Calls > B.Value->Calls; });
+	}
+	else if (SortBy == TEXT("Bytes"))
+	{
+		Sorted.Sort([](const TPair<FName, const FProfileRecord*>& A, const TPair<FName, const FProfileRecord*>& B) { return A.Value->ArgumentBytes + A.Value->ResultBytes > B.Value->ArgumentBytes + B.Value->ResultBytes; });
+	}
+	else if (SortBy == TEXT("Latency"))
+	{
+		Sorted.Sort([](const TPair<FName, const FProfileRecord*>& A, const TPair<FName, const FProfileRecord*>& B) { return A.Value->MaxLatency > B.Value->MaxLatency; });
+	}
+	else
+	{
+		Sorted.Sort([](const TPair<FName, const FProfileRecord*>& A, const TPair<FName, const FProfileRecord*>& B) { return A.Value->GetCycles() > B.Value->GetCycles(); });
+	}
+
+	if (!bProfileBridge)
+	{
+		UE_LOG(LogWebInterfaceBrowser, Display, TEXT("WebUI.Bridge.Profile is off, nothing new is being recorded."));
+	}
+
+	UE_LOG(LogWebInterfaceBrowser, Display, TEXT("%-48s %10s %12s %12s %10s %10s %10s %10s %10s"),
+		TEXT("Name"), TEXT("Calls"), TEXT("Args (B)"), TEXT("Results (B)"), TEXT("Decode"), TEXT("Process"), TEXT("Encode"), TEXT("Avg Lat"), TEXT("Max Lat"));
+
+	const int32 Shown = Count > 0 ? FMath::Min(Count, Sorted.Num()) : Sorted.Num();
+	for (int32 Index = 0; Index < Shown; Index++)
+	{
+		const FProfileRecord& Record = *Sorted[Index].Value;
+
+		// Events are dispatched rather than processed, times are in milliseconds
+		const uint64 ProcessCycles = Record.Cycles[(int32)EPhase::Process] + Record.Cycles[(int32)EPhase::Event];
+		UE_LOG(LogWebInterfaceBrowser, Display, TEXT("%-48s %10lld %12lld %12lld %10.3f %10.3f %10.3f %10.3f %10.3f"),
+			*FString::Printf(TEXT("%s%s"), Record.bEvent ? TEXT("event ") : TEXT(""), *Sorted[Index].Key.ToString()),
+			Record.Calls,
+			Record.ArgumentBytes,
+			Record.ResultBytes,
+			FPlatformTime::ToMilliseconds64(Record.Cycles[(int32)EPhase::Decode]),
+			FPlatformTime::ToMilliseconds64(ProcessCycles),
+			FPlatformTime::ToMilliseconds64(Record.Cycles[(int32)EPhase::Encode]),
+			Record.Results > 0 ? Record.Latency * 1000.0 / Record.Results : 0.0,
+			Record.MaxLatency * 1000.0);
+	}
+}
+
+void FWebInterfaceJSProfiler::Reset()
+{
+	GetRecords().Reset();
+}
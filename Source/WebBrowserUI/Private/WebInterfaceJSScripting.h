@@ -5,6 +5,7 @@
 #include "Misc/Guid.h"
 #include "WebInterfaceJSFunction.h"
 #include "UObject/GCObject.h"
+#include "UObject/UObjectGlobals.h"
 
 class Error;
 
@@ -18,7 +19,14 @@ public:
 	FWebInterfaceJSScripting(bool bInJSBindingToLoweringEnabled)
 		: BaseGuid(FGuid::NewGuid())
 		, bJSBindingToLoweringEnabled(bInJSBindingToLoweringEnabled)
-	{}
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FWebInterfaceJSScripting::HandlePostGarbageCollect);
+	}
+
+	virtual ~FWebInterfaceJSScripting()
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	}
 
 	virtual void BindUObject(const FString& Name, UObject* Object, bool bIsPermanent = true) =0;
 	virtual void UnbindUObject(const FString& Name, UObject* Object = nullptr, bool bIsPermanent = true) =0;
@@ -27,6 +35,50 @@ public:
 	virtual void InvokeJSFunction(FGuid FunctionId, int32 ArgCount, FWebInterfaceJSParam Arguments[], bool bIsError=false) =0;
 	virtual void InvokeJSErrorResult(FGuid FunctionId, const FString& Error) =0;
 
+	/** Parses an object or callback id from the renderer, trying the format ids are sent in first. */
+	static bool ParseId(const FString& String, FGuid& OutGuid)
+	{
+		return FGuid::ParseExact(String, EGuidFormats::Digits, OutGuid) || FGuid::Parse(String, OutGuid);
+	}
+
+	/**
+	 * Callbacks that may be invoked from a worker thread, by id.
+	 * Callbacks invoked off the game thread only carry their id over, so the reference count of the scripting is never touched there.
+	 * Only used on the game thread.
+	 */
+	static void AddWorkerCallback(const FGuid& CallbackId, const TSharedRef<FWebInterfaceJSScripting>& Scripting)
+	{
+		check(IsInGameThread());
+
+		// Forget callbacks of scripting that is gone, then responses that were never resolved
+		TMap<FGuid, TWeakPtr<FWebInterfaceJSScripting>>& Callbacks = GetWorkerCallbacks();
+		if (Callbacks.Num() >= 1024)
+		{
+			for (auto It = Callbacks.CreateIterator(); It; ++It)
+			{
+				if (!It.Value().IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			if (Callbacks.Num() >= 1024)
+			{
+				Callbacks.Reset();
+			}
+		}
+		Callbacks.Add(CallbackId, Scripting);
+	}
+
+	static TSharedPtr<FWebInterfaceJSScripting> RemoveWorkerCallback(const FGuid& CallbackId)
+	{
+		check(IsInGameThread());
+
+		TWeakPtr<FWebInterfaceJSScripting> Scripting;
+		GetWorkerCallbacks().RemoveAndCopyValue(CallbackId, Scripting);
+		return Scripting.Pin();
+	}
+
 	FString GetBindingName(const FString& Name, UObject* Object) const
 	{
 		return bJSBindingToLoweringEnabled ? Name.ToLower() : Name;
@@ -61,84 +113,146 @@ public:
 	}
 
 protected:
-	// Creates a reversible memory addres -> psuedo-guid mapping.
-	// This is done by xoring the address with the first 64 bits of a base guid owned by the instance.
-	// Used to identify UObjects from the render process withough exposing internal pointers.
+	// Drops anything cached per class.
+	// Classes and functions replaced by hot reload or blueprint compilation are collected, and their addresses may be reused.
+	virtual void FlushClassCaches() {}
+
+	// Object ids keep the guid format the renderer expects, but are built from a slot table instead of the object address.
+	// The slot index and its generation are mixed with a base guid owned by the instance, so ids can't be guessed across instances,
+	// and ids of released objects are rejected once their slot is reused.
+	FGuid SlotToGuid(int32 Slot, uint32 Generation) const
+	{
+		return FGuid(BaseGuid[0] ^ static_cast<uint32>(Slot), BaseGuid[1] ^ Generation, BaseGuid[2], BaseGuid[3]);
+	}
+
 	FGuid PtrToGuid(UObject* Ptr)
 	{
-		FGuid Guid = BaseGuid;
-		if (Ptr == nullptr)
+		if (Ptr != nullptr)
 		{
-			Guid.Invalidate();
-		}
-		else
-		{
-			UPTRINT IntPtr = reinterpret_cast<UPTRINT>(Ptr);
-			if (sizeof(UPTRINT) > 4)
+			if (const ObjectBinding* Binding = BoundObjects.Find(Ptr))
 			{
-				Guid[0] ^= (static_cast<uint64>(IntPtr) >> 32);
+				return SlotToGuid(Binding->Slot, ObjectSlots[Binding->Slot].Generation);
 			}
-			Guid[1] ^= IntPtr & 0xFFFFFFFF;
 		}
-		return Guid;
+
+		// Objects that aren't bound have no id
+		return FGuid();
 	}
 
-	// In addition to reversing the mapping, it verifies that we are currently holding on to an instance of that UObject
+	// Resolves an id with a direct slot lookup, which also verifies that we are currently holding on to an instance of that UObject
 	UObject* GuidToPtr(const FGuid& Guid)
 	{
-		UPTRINT IntPtr = 0;
-		if (sizeof(UPTRINT) > 4)
+		if (Guid[2] != BaseGuid[2] || Guid[3] != BaseGuid[3])
 		{
-			IntPtr = static_cast<UPTRINT>(static_cast<uint64>(Guid[0] ^ BaseGuid[0]) << 32);
+			return nullptr;
 		}
-		IntPtr |= (Guid[1] ^ BaseGuid[1]) & 0xFFFFFFFF;
 
-		UObject* Result = reinterpret_cast<UObject*>(IntPtr);
-		if (BoundObjects.Contains(Result))
+		const int32 Slot = static_cast<int32>(Guid[0] ^ BaseGuid[0]);
+		if (!ObjectSlots.IsValidIndex(Slot))
 		{
-			return Result;
+			return nullptr;
 		}
-		else
+
+		const FObjectSlot& Entry = ObjectSlots[Slot];
+		if (Entry.Object == nullptr || Entry.Generation != (Guid[1] ^ BaseGuid[1]))
 		{
 			return nullptr;
 		}
+
+		// Slots hold plain pointers, only objects that are still bound are kept alive by the garbage collector
+		const ObjectBinding* Binding = BoundObjects.Find(Entry.Object);
+		return Binding != nullptr && Binding->Slot == Slot ? Entry.Object : nullptr;
 	}
 
-	void RetainBinding(UObject* Object)
+	// Gets the formatted id of a bound object, formatted once when its slot was allocated.
+	const FString& GetObjectId(int32 Slot) const
 	{
-		if (BoundObjects.Contains(Object))
+		return ObjectSlots[Slot].Id;
+	}
+
+	int32 RetainBinding(UObject* Object)
+	{
+		if (ObjectBinding* Binding = BoundObjects.Find(Object))
 		{
-			if(!BoundObjects[Object].bIsPermanent)
+			if(!Binding->bIsPermanent)
 			{
-				BoundObjects[Object].Refcount++;
+				Binding->Refcount++;
 			}
+			return Binding->Slot;
 		}
-		else
-		{
-			BoundObjects.Add(Object, {false, 1});
-		}
+
+		const int32 Slot = AllocateObjectSlot(Object);
+		BoundObjects.Add(Object, {false, 1, Slot});
+		return Slot;
 	}
 
 	void ReleaseBinding(UObject* Object)
 	{
-		if (BoundObjects.Contains(Object))
+		if (ObjectBinding* Binding = BoundObjects.Find(Object))
 		{
-			ObjectBinding& Binding = BoundObjects[Object];
-			if(!Binding.bIsPermanent)
+			if(!Binding->bIsPermanent)
 			{
-				Binding.Refcount--;
-				if (Binding.Refcount <= 0)
+				Binding->Refcount--;
+				if (Binding->Refcount <= 0)
 				{
-					BoundObjects.Remove(Object);
+					RemoveBinding(Object);
 				}
 			}
 		}
 	}
 
+	void MakeBindingPermanent(UObject* Object)
+	{
+		if (ObjectBinding* Binding = BoundObjects.Find(Object))
+		{
+			Binding->bIsPermanent = true;
+			Binding->Refcount = -1;
+		}
+		else
+		{
+			BoundObjects.Add(Object, {true, -1, AllocateObjectSlot(Object)});
+		}
+	}
+
+	void RemoveBinding(UObject* Object)
+	{
+		ObjectBinding Binding;
+		if (BoundObjects.RemoveAndCopyValue(Object, Binding))
+		{
+			FreeObjectSlot(Binding.Slot);
+		}
+	}
+
+	int32 AllocateObjectSlot(UObject* Object)
+	{
+		const int32 Slot = FreeObjectSlots.Num() > 0 ? FreeObjectSlots.Pop() : ObjectSlots.AddDefaulted();
+		FObjectSlot& Entry = ObjectSlots[Slot];
+		Entry.Object = Object;
+		Entry.Id = SlotToGuid(Slot, Entry.Generation).ToString(EGuidFormats::Digits);
+		return Slot;
+	}
+
+	void FreeObjectSlot(int32 Slot)
+	{
+		FObjectSlot& Entry = ObjectSlots[Slot];
+		Entry.Object = nullptr;
+		Entry.Generation++;
+		Entry.Id.Reset();
+		FreeObjectSlots.Push(Slot);
+	}
+
 	struct ObjectBinding
 	{
 		bool bIsPermanent;
 		int32 Refcount;
+		int32 Slot;
+	};
+
+	struct FObjectSlot
+	{
+		UObject* Object = nullptr;
+		uint32 Generation = 0;
+		FString Id;
 	};
 
 	/** Private data */
@@ -151,9 +265,27 @@ protected:
 	TMap<UObject*, ObjectBinding> BoundObjects;
 #endif
 
+	/** Handle table for bound objects, indexed by ObjectBinding::Slot. */
+	TArray<FObjectSlot> ObjectSlots;
+	TArray<int32> FreeObjectSlots;
+
 	/** Reverse lookup for permanent bindings */
 	TMap<FString, UObject*> PermanentUObjectsByName;
 
 	/** The to-lowering option enable for the binding names. */
 	const bool bJSBindingToLoweringEnabled;
+
+private:
+	static TMap<FGuid, TWeakPtr<FWebInterfaceJSScripting>>& GetWorkerCallbacks()
+	{
+		static TMap<FGuid, TWeakPtr<FWebInterfaceJSScripting>> Callbacks;
+		return Callbacks;
+	}
+
+	void HandlePostGarbageCollect()
+	{
+		FlushClassCaches();
+	}
+
+	FDelegateHandle PostGarbageCollectHandle;
 };
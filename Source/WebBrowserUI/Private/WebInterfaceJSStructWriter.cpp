@@ -0,0 +1,501 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "WebInterfaceJSStructWriter.h"
+
+#include "WebInterfaceJSScripting.h"
+#include "UObject/PropertyPortFlags.h"
+#include "Misc/CString.h"
+
+namespace JSStructWriterFuncs
+{
+	void AppendRaw(TArray<ANSICHAR>& Out, const ANSICHAR* Text)
+	{
+		Out.Append(Text, FCStringAnsi::Strlen(Text));
+	}
+
+	void AppendRaw(TArray<ANSICHAR>& Out, const FString& Text)
+	{
+		FTCHARToUTF8 Converted(*Text, Text.Len());
+		Out.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+	}
+
+	void AppendCodePoint(TArray<ANSICHAR>& Out, uint32 Code)
+	{
+		if (Code < 0x80)
+		{
+			Out.Add(static_cast<ANSICHAR>(Code));
+		}
+		else if (Code < 0x800)
+		{
+			Out.Add(static_cast<ANSICHAR>(0xC0 | (Code >> 6)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (Code & 0x3F)));
+		}
+		else if (Code < 0x10000)
+		{
+			Out.Add(static_cast<ANSICHAR>(0xE0 | (Code >> 12)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | ((Code >> 6) & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (Code & 0x3F)));
+		}
+		else
+		{
+			Out.Add(static_cast<ANSICHAR>(0xF0 | (Code >> 18)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | ((Code >> 12) & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | ((Code >> 6) & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (Code & 0x3F)));
+		}
+	}
+
+	/** Appends a quoted and escaped string, encoding it as UTF-8 on the way. */
+	void AppendString(TArray<ANSICHAR>& Out, const FString& Text)
+	{
+		static const ANSICHAR Hex[] = "0123456789abcdef";
+
+		const TCHAR* Chars = *Text;
+		const int32 Length = Text.Len();
+
+		Out.Reserve(Out.Num() + Length + 2);
+		Out.Add('"');
+
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			uint32 Code = static_cast<uint32>(Chars[Index]);
+
+			// strings are UTF-16 on some platforms
+			if (Code >= 0xD800 && Code <= 0xDBFF && Index + 1 < Length && static_cast<uint32>(Chars[Index + 1]) >= 0xDC00 && static_cast<uint32>(Chars[Index + 1]) <= 0xDFFF)
+			{
+				Code = 0x10000 + ((Code - 0xD800) << 10) + (static_cast<uint32>(Chars[++Index]) - 0xDC00);
+			}
+			else if ((Code >= 0xD800 && Code <= 0xDFFF) || Code > 0x10FFFF)
+			{
+				Code = 0xFFFD;
+			}
+
+			switch (Code)
+			{
+			case '"':  AppendRaw(Out, "\\\""); break;
+			case '\\': AppendRaw(Out, "\\\\"); break;
+			case '\n': AppendRaw(Out, "\\n"); break;
+			case '\r': AppendRaw(Out, "\\r"); break;
+			case '\t': AppendRaw(Out, "\\t"); break;
+			case '\b': AppendRaw(Out, "\\b"); break;
+			case '\f': AppendRaw(Out, "\\f"); break;
+
+			// line terminators inside string literals
+			case 0x2028: AppendRaw(Out, "\\u2028"); break;
+			case 0x2029: AppendRaw(Out, "\\u2029"); break;
+
+			default:
+				if (Code < 0x20)
+				{
+					AppendRaw(Out, "\\u00");
+					Out.Add(Hex[Code >> 4]);
+					Out.Add(Hex[Code & 0xF]);
+				}
+				else
+				{
+					AppendCodePoint(Out, Code);
+				}
+				break;
+			}
+		}
+
+		Out.Add('"');
+	}
+
+	void AppendUnsigned(TArray<ANSICHAR>& Out, uint64 Value)
+	{
+		ANSICHAR Digits[20];
+		int32 Count = 0;
+
+		do
+		{
+			Digits[Count++] = static_cast<ANSICHAR>('0' + Value % 10);
+			Value /= 10;
+		}
+		while (Value != 0);
+
+		while (Count > 0)
+		{
+			Out.Add(Digits[--Count]);
+		}
+	}
+
+	void AppendSigned(TArray<ANSICHAR>& Out, int64 Value)
+	{
+		if (Value < 0)
+		{
+			Out.Add('-');
+			AppendUnsigned(Out, 0 - static_cast<uint64>(Value));
+		}
+		else
+		{
+			AppendUnsigned(Out, static_cast<uint64>(Value));
+		}
+	}
+
+	/** Appends the shortest form that reads back as the same value, so 0.1f is written as 0.1. */
+	void AppendDouble(TArray<ANSICHAR>& Out, double Value, bool bSingle)
+	{
+		if (FMath::IsNaN(Value))
+		{
+			AppendRaw(Out, "NaN");
+			return;
+		}
+		if (!FMath::IsFinite(Value))
+		{
+			AppendRaw(Out, Value > 0 ? "Infinity" : "-Infinity");
+			return;
+		}
+
+		ANSICHAR Digits[32];
+		const int32 MaxPrecision = bSingle ? 9 : 17;
+
+		for (int32 Precision = bSingle ? 6 : 15; ; ++Precision)
+		{
+			FCStringAnsi::Snprintf(Digits, sizeof(Digits), "%.*g", Precision, Value);
+
+			const double Parsed = FCStringAnsi::Atod(Digits);
+			if (Precision >= MaxPrecision || (bSingle ? static_cast<float>(Parsed) == static_cast<float>(Value) : Parsed == Value))
+			{
+				break;
+			}
+		}
+
+		AppendRaw(Out, Digits);
+	}
+}
+
+FString FWebInterfaceJSStructWriter::Write(const FWebInterfaceJSScripting& Scripting, UStruct* TypeInfo, const void* StructPtr, TFunctionRef<FString(UObject*)> ConvertObject)
+{
+	Buffer.Reset();
+	WriteStruct(Scripting, TypeInfo, StructPtr, ConvertObject);
+
+	FUTF8ToTCHAR Converted(Buffer.GetData(), Buffer.Num());
+	return FString(Converted.Length(), Converted.Get());
+}
+
+void FWebInterfaceJSStructWriter::Flush()
+{
+	Plans.Empty();
+}
+
+TSharedRef<const FWebInterfaceJSStructWriter::FPlan> FWebInterfaceJSStructWriter::GetPlan(const FWebInterfaceJSScripting& Scripting, UStruct* TypeInfo)
+{
+	if (const TSharedRef<const FPlan>* Found = Plans.Find(TypeInfo))
+	{
+		return *Found;
+	}
+
+	TSharedRef<FPlan> Plan = MakeShared<FPlan>();
+	for (TFieldIterator<FPropertyType> It(TypeInfo); It; ++It)
+	{
+		FEntry& Entry = Plan->AddDefaulted_GetRef();
+		MakeEntry(*It, Entry);
+
+		JSStructWriterFuncs::AppendString(Entry.Key, Scripting.GetBindingName(*It));
+		Entry.Key.Add(':');
+	}
+
+	Plans.Add(TypeInfo, Plan);
+	return Plan;
+}
+
+void FWebInterfaceJSStructWriter::MakeEntry(FPropertyType* Property, FEntry& Entry)
+{
+	Entry.Property = Property;
+
+	if (Property->IsA<FBoolPropertyType>())
+	{
+		Entry.Kind = EKind::Bool;
+	}
+	else if (Property->IsA<FEnumPropertyType>())
+	{
+		FEnumPropertyType* EnumProperty = static_cast<FEnumPropertyType*>(Property);
+
+		Entry.Kind = EKind::Enum;
+		Entry.Enum = EnumProperty->GetEnum();
+		Entry.Numeric = EnumProperty->GetUnderlyingProperty();
+	}
+	else if (Property->IsA<FNumericPropertyType>())
+	{
+		Entry.Numeric = static_cast<FNumericPropertyType*>(Property);
+
+		if (UEnum* Enum = Entry.Numeric->GetIntPropertyEnum())
+		{
+			Entry.Kind = EKind::Enum;
+			Entry.Enum = Enum;
+		}
+		else if (Entry.Numeric->IsFloatingPoint())
+		{
+			Entry.Kind = EKind::Float;
+			Entry.bSingle = Property->IsA<FFloatPropertyType>();
+		}
+		else if (Property->IsA<FBytePropertyType>() || Property->IsA<FUInt16PropertyType>() || Property->IsA<FUInt32PropertyType>() || Property->IsA<FUInt64PropertyType>())
+		{
+			Entry.Kind = EKind::Unsigned;
+		}
+		else
+		{
+			Entry.Kind = EKind::Signed;
+		}
+	}
+	else if (Property->IsA<FStrPropertyType>())
+	{
+		Entry.Kind = EKind::String;
+	}
+	else if (Property->IsA<FNamePropertyType>())
+	{
+		Entry.Kind = EKind::Name;
+	}
+	else if (Property->IsA<FTextPropertyType>())
+	{
+		Entry.Kind = EKind::Text;
+	}
+	else if (Property->IsA<FStructPropertyType>())
+	{
+		Entry.Kind = EKind::Struct;
+		Entry.Struct = static_cast<FStructPropertyType*>(Property)->Struct;
+	}
+	else if (Property->IsA<FArrayPropertyType>())
+	{
+		FPropertyType* Inner = static_cast<FArrayPropertyType*>(Property)->Inner;
+
+		Entry.Kind = EKind::Array;
+		Entry.Stride = Inner->GetSize();
+		MakeEntry(Inner, Entry.Inner.AddDefaulted_GetRef());
+	}
+	else if (Property->IsA<FSetPropertyType>())
+	{
+		Entry.Kind = EKind::Set;
+		MakeEntry(static_cast<FSetPropertyType*>(Property)->ElementProp, Entry.Inner.AddDefaulted_GetRef());
+	}
+	else if (Property->IsA<FMapPropertyType>())
+	{
+		FMapPropertyType* MapProperty = static_cast<FMapPropertyType*>(Property);
+
+		Entry.Kind = EKind::Map;
+		MakeEntry(MapProperty->KeyProp, Entry.Inner.AddDefaulted_GetRef());
+		MakeEntry(MapProperty->ValueProp, Entry.Inner.AddDefaulted_GetRef());
+	}
+	else if (Property->IsA<FClassPropertyType>())
+	{
+		Entry.Kind = EKind::Class;
+	}
+	else if (Property->IsA<FObjectPropertyType>())
+	{
+		Entry.Kind = EKind::Object;
+	}
+	else
+	{
+		Entry.Kind = EKind::Other;
+	}
+}
+
+void FWebInterfaceJSStructWriter::WriteStruct(const FWebInterfaceJSScripting& Scripting, UStruct* TypeInfo, const void* StructPtr, TFunctionRef<FString(UObject*)> ConvertObject)
+{
+	TSharedRef<const FPlan> Plan = GetPlan(Scripting, TypeInfo);
+
+	Buffer.Add('{');
+	for (int32 Index = 0; Index < Plan->Num(); ++Index)
+	{
+		const FEntry& Entry = (*Plan)[Index];
+		if (Index > 0)
+		{
+			Buffer.Add(',');
+		}
+
+		Buffer.Append(Entry.Key);
+
+		// static arrays are written as arrays
+		const int32 ArrayDim = Entry.Property->ArrayDim;
+		if (ArrayDim == 1)
+		{
+			WriteValue(Scripting, Entry, Entry.Property->ContainerPtrToValuePtr<void>(StructPtr), ConvertObject);
+			continue;
+		}
+
+		Buffer.Add('[');
+		for (int32 ArrayIndex = 0; ArrayIndex < ArrayDim; ++ArrayIndex)
+		{
+			if (ArrayIndex > 0)
+			{
+				Buffer.Add(',');
+			}
+
+			WriteValue(Scripting, Entry, Entry.Property->ContainerPtrToValuePtr<void>(StructPtr, ArrayIndex), ConvertObject);
+		}
+		Buffer.Add(']');
+	}
+	Buffer.Add('}');
+}
+
+void FWebInterfaceJSStructWriter::WriteValue(const FWebInterfaceJSScripting& Scripting, const FEntry& Entry, const void* Value, TFunctionRef<FString(UObject*)> ConvertObject)
+{
+	switch (Entry.Kind)
+	{
+	case EKind::Bool:
+		JSStructWriterFuncs::AppendRaw(Buffer, static_cast<FBoolPropertyType*>(Entry.Property)->GetPropertyValue(Value) ? "true" : "false");
+		break;
+
+	case EKind::Signed:
+		JSStructWriterFuncs::AppendSigned(Buffer, Entry.Numeric->GetSignedIntPropertyValue(Value));
+		break;
+
+	case EKind::Unsigned:
+		JSStructWriterFuncs::AppendUnsigned(Buffer, Entry.Numeric->GetUnsignedIntPropertyValue(Value));
+		break;
+
+	case EKind::Float:
+		JSStructWriterFuncs::AppendDouble(Buffer, Entry.Numeric->GetFloatingPointPropertyValue(Value), Entry.bSingle);
+		break;
+
+	case EKind::Enum:
+		JSStructWriterFuncs::AppendString(Buffer, Entry.Enum->GetNameStringByValue(Entry.Numeric->GetSignedIntPropertyValue(Value)));
+		break;
+
+	case EKind::String:
+		JSStructWriterFuncs::AppendString(Buffer, *static_cast<const FString*>(Value));
+		break;
+
+	case EKind::Name:
+		JSStructWriterFuncs::AppendString(Buffer, static_cast<const FName*>(Value)->ToString());
+		break;
+
+	case EKind::Text:
+		JSStructWriterFuncs::AppendString(Buffer, static_cast<const FText*>(Value)->ToString());
+		break;
+
+	case EKind::Struct:
+		WriteStruct(Scripting, Entry.Struct, Value, ConvertObject);
+		break;
+
+	case EKind::Array:
+	{
+		const FScriptArray* Array = static_cast<const FScriptArray*>(Value);
+		const uint8* Data = static_cast<const uint8*>(Array->GetData());
+
+		Buffer.Add('[');
+		for (int32 Index = 0; Index < Array->Num(); ++Index)
+		{
+			if (Index > 0)
+			{
+				Buffer.Add(',');
+			}
+
+			WriteValue(Scripting, Entry.Inner[0], Data + Index * Entry.Stride, ConvertObject);
+		}
+		Buffer.Add(']');
+		break;
+	}
+
+	case EKind::Set:
+	{
+		FScriptSetHelper Helper(static_cast<FSetPropertyType*>(Entry.Property), Value);
+
+		Buffer.Add('[');
+		for (int32 Index = 0, Remaining = Helper.Num(); Remaining > 0; ++Index)
+		{
+			if (!Helper.IsValidIndex(Index))
+			{
+				continue;
+			}
+
+			if (Remaining < Helper.Num())
+			{
+				Buffer.Add(',');
+			}
+			Remaining--;
+
+			WriteValue(Scripting, Entry.Inner[0], Helper.GetElementPtr(Index), ConvertObject);
+		}
+		Buffer.Add(']');
+		break;
+	}
+
+	case EKind::Map:
+	{
+		FScriptMapHelper Helper(static_cast<FMapPropertyType*>(Entry.Property), Value);
+
+		Buffer.Add('{');
+		for (int32 Index = 0, Remaining = Helper.Num(); Remaining > 0; ++Index)
+		{
+			if (!Helper.IsValidIndex(Index))
+			{
+				continue;
+			}
+
+			if (Remaining < Helper.Num())
+			{
+				Buffer.Add(',');
+			}
+			Remaining--;
+
+			WriteMapKey(Entry.Inner[0], Helper.GetKeyPtr(Index));
+			Buffer.Add(':');
+			WriteValue(Scripting, Entry.Inner[1], Helper.GetValuePtr(Index), ConvertObject);
+		}
+		Buffer.Add('}');
+		break;
+	}
+
+	case EKind::Class:
+	case EKind::Object:
+	{
+		UObject* Object = static_cast<FObjectPropertyBaseType*>(Entry.Property)->GetObjectPropertyValue(Value);
+		if (Object == nullptr)
+		{
+			JSStructWriterFuncs::AppendRaw(Buffer, "null");
+		}
+		else if (Entry.Kind == EKind::Class)
+		{
+			JSStructWriterFuncs::AppendString(Buffer, Object->GetPathName());
+		}
+		else
+		{
+			JSStructWriterFuncs::AppendRaw(Buffer, ConvertObject(Object));
+		}
+		break;
+	}
+
+	default:
+		JSStructWriterFuncs::AppendString(Buffer, ExportText(Entry, Value));
+		break;
+	}
+}
+
+void FWebInterfaceJSStructWriter::WriteMapKey(const FEntry& Entry, const void* Value)
+{
+	// keys of JavaScript objects are always strings
+	switch (Entry.Kind)
+	{
+	case EKind::Enum:
+		JSStructWriterFuncs::AppendString(Buffer, Entry.Enum->GetNameStringByValue(Entry.Numeric->GetSignedIntPropertyValue(Value)));
+		break;
+
+	case EKind::String:
+		JSStructWriterFuncs::AppendString(Buffer, *static_cast<const FString*>(Value));
+		break;
+
+	case EKind::Name:
+		JSStructWriterFuncs::AppendString(Buffer, static_cast<const FName*>(Value)->ToString());
+		break;
+
+	case EKind::Text:
+		JSStructWriterFuncs::AppendString(Buffer, static_cast<const FText*>(Value)->ToString());
+		break;
+
+	default:
+		JSStructWriterFuncs::AppendString(Buffer, ExportText(Entry, Value));
+		break;
+	}
+}
+
+FString FWebInterfaceJSStructWriter::ExportText(const FEntry& Entry, const void* Value)
+{
+	FString Text;
+#if UE_VERSION >= 501
+	Entry.Property->ExportTextItem_Direct(Text, Value, nullptr, nullptr, PPF_None);
+#else
+	Entry.Property->ExportTextItem(Text, Value, nullptr, nullptr, PPF_None);
+#endif
+	return Text;
+}
@@ -0,0 +1,132 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UnrealType.h"
+#include "Templates/Function.h"
+
+class FWebInterfaceJSScripting;
+
+/**
+ * Writes structs as JavaScript literals for the scripting backends that send scripts as text.
+ *
+ * The properties of each struct are looked up once and kept as a plan, with their binding names already encoded.
+ * Values are written as UTF-8 into a buffer that is reused between calls, and converted to a string once at the end.
+ */
+class FWebInterfaceJSStructWriter
+{
+public:
+
+	/**
+	 * Write a struct as a JavaScript object literal.
+	 *
+	 * @param Scripting The scripting the literal is for, which decides the binding names.
+	 * @param TypeInfo The type of the struct.
+	 * @param StructPtr The struct to write.
+	 * @param ConvertObject Converts objects referenced by the struct to their JavaScript representation.
+	 * @return The object literal.
+	 */
+	FString Write(const FWebInterfaceJSScripting& Scripting, UStruct* TypeInfo, const void* StructPtr, TFunctionRef<FString(UObject*)> ConvertObject);
+
+	/** Forget the cached plans, the structs they were made for may be gone. */
+	void Flush();
+
+private:
+
+#if UE_VERSION >= 425
+	typedef FProperty FPropertyType;
+	typedef FNumericProperty FNumericPropertyType;
+	typedef FBoolProperty FBoolPropertyType;
+	typedef FSetProperty FSetPropertyType;
+	typedef FMapProperty FMapPropertyType;
+	typedef FObjectPropertyBase FObjectPropertyBaseType;
+	typedef FByteProperty FBytePropertyType;
+	typedef FEnumProperty FEnumPropertyType;
+	typedef FFloatProperty FFloatPropertyType;
+	typedef FUInt16Property FUInt16PropertyType;
+	typedef FUInt32Property FUInt32PropertyType;
+	typedef FUInt64Property FUInt64PropertyType;
+	typedef FStrProperty FStrPropertyType;
+	typedef FNameProperty FNamePropertyType;
+	typedef FTextProperty FTextPropertyType;
+	typedef FStructProperty FStructPropertyType;
+	typedef FArrayProperty FArrayPropertyType;
+	typedef FClassProperty FClassPropertyType;
+	typedef FObjectProperty FObjectPropertyType;
+#else
+	typedef UProperty FPropertyType;
+	typedef UNumericProperty FNumericPropertyType;
+	typedef UBoolProperty FBoolPropertyType;
+	typedef USetProperty FSetPropertyType;
+	typedef UMapProperty FMapPropertyType;
+	typedef UObjectPropertyBase FObjectPropertyBaseType;
+	typedef UByteProperty FBytePropertyType;
+	typedef UEnumProperty FEnumPropertyType;
+	typedef UFloatProperty FFloatPropertyType;
+	typedef UUInt16Property FUInt16PropertyType;
+	typedef UUInt32Property FUInt32PropertyType;
+	typedef UUInt64Property FUInt64PropertyType;
+	typedef UStrProperty FStrPropertyType;
+	typedef UNameProperty FNamePropertyType;
+	typedef UTextProperty FTextPropertyType;
+	typedef UStructProperty FStructPropertyType;
+	typedef UArrayProperty FArrayPropertyType;
+	typedef UClassProperty FClassPropertyType;
+	typedef UObjectProperty FObjectPropertyType;
+#endif
+
+	enum class EKind : uint8
+	{
+		Bool,
+		Signed,
+		Unsigned,
+		Float,
+		Enum,
+		String,
+		Name,
+		Text,
+		Struct,
+		Array,
+		Set,
+		Map,
+		Object,
+		Class,
+		Other
+	};
+
+	struct FEntry
+	{
+		EKind Kind = EKind::Other;
+		FPropertyType* Property = nullptr;
+
+		/** The binding name as "name": for properties of a struct. */
+		TArray<ANSICHAR> Key;
+
+		FNumericPropertyType* Numeric = nullptr;
+		UEnum* Enum = nullptr;
+		UScriptStruct* Struct = nullptr;
+		bool bSingle = false;
+
+		/** The element of arrays and sets, or the key and value of maps. */
+		TArray<FEntry> Inner;
+		int32 Stride = 0;
+	};
+
+	typedef TArray<FEntry> FPlan;
+
+	TSharedRef<const FPlan> GetPlan(const FWebInterfaceJSScripting& Scripting, UStruct* TypeInfo);
+	void MakeEntry(FPropertyType* Property, FEntry& Entry);
+
+	void WriteStruct(const FWebInterfaceJSScripting& Scripting, UStruct* TypeInfo, const void* StructPtr, TFunctionRef<FString(UObject*)> ConvertObject);
+	void WriteValue(const FWebInterfaceJSScripting& Scripting, const FEntry& Entry, const void* Value, TFunctionRef<FString(UObject*)> ConvertObject);
+	void WriteMapKey(const FEntry& Entry, const void* Value);
+
+	/** Properties that have no JavaScript counterpart are written as their exported text. */
+	static FString ExportText(const FEntry& Entry, const void* Value);
+
+	/** Plans by struct, shared so that they stay alive while nested structs add their own. */
+	TMap<const UStruct*, TSharedRef<const FPlan>> Plans;
+
+	/** UTF-8 output, kept between calls. */
+	TArray<ANSICHAR> Buffer;
+};
@@ -204,4 +204,10 @@ public:
 	virtual UMaterialInterface* GetDefaultMaterial() = 0;
 	/** Get a reference to UWebBrowser's transparent material*/
 	virtual UMaterialInterface* GetDefaultTranslucentMaterial() = 0;
+
+	/**
+	 * Event that is broadcast once per tick, before the browser message pump runs.
+	 * Work that was batched during the frame should be flushed from here so it goes out with the next pump.
+	 */
+	virtual FSimpleMulticastDelegate& OnPreTick() = 0;
 };
@@ -11,6 +11,7 @@ class Error;
 class FSlateShaderResource;
 class IWebInterfaceBrowserDialog;
 class IWebInterfaceBrowserPopupFeatures;
+struct FWebInterfaceJSParam;
 enum class EWebInterfaceBrowserDialogEventResponse;
 
 enum class EWebInterfaceBrowserDocumentState
@@ -322,6 +323,70 @@ public:
 	/** Execute Javascript on the page. */
 	virtual void ExecuteJavascript(const FString& Script) = 0;
 
+	/**
+	 * Call ue.interface[Function] on the page, passing the argument as native values instead of script source.
+	 *
+	 * @param Function The name of the function on ue.interface.
+	 * @param Data The argument to pass, or nullptr to call the function without arguments.
+	 * @return false if the call couldn't be delivered this way, in which case ExecuteJavascript should be used instead.
+	 */
+	virtual bool CallJavascriptFunction(const FString& Function, const FWebInterfaceJSParam* Data) { return false; }
+
+	/**
+	 * Call several ue.interface functions in order, with a single message.
+	 *
+	 * @param Calls An array of [function, data] arrays, where data is left out to call without arguments.
+	 * @return false if the calls couldn't be delivered this way, in which case ExecuteJavascript should be used instead.
+	 */
+	virtual bool CallJavascriptBatch(const FWebInterfaceJSParam& Calls) { return false; }
+
+	/**
+	 * Send the values of properties of a bound object to the page, and then only the ones that changed, once per frame.
+	 *
+	 * @param Name The name the object is bound with.
+	 * @param Object The object to observe.
+	 * @param Properties The blueprint visible properties to send, or empty to send all of them.
+	 * @param bEveryFrame Whether to check for changes every frame, otherwise only after MarkUObjectDirty.
+	 */
+	virtual void ObserveUObject(const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame) {}
+
+	/** Stop sending property changes for an object, or for every object observed with the name if Object is null. */
+	virtual void UnobserveUObject(const FString& Name, UObject* Object = nullptr) {}
+
+	/** Check the observed properties of an object for changes at the end of the frame. */
+	virtual void MarkUObjectDirty(UObject* Object) {}
+
+	/**
+	 * Run methods of a bound object on a worker thread when the page calls them, so they don't hold up the game thread.
+	 * Only native functions marked meta=(BlueprintThreadSafe) are accepted, others keep running on the game thread.
+	 * Garbage collection can't run while one of these methods does, so a slow method stalls a collection on the game thread.
+	 *
+	 * @param Object The object the methods belong to.
+	 * @param Methods The methods to run on a worker thread, or empty to run all of them on the game thread.
+	 */
+	virtual void SetUObjectAsyncMethods(UObject* Object, const TArray<FName>& Methods) {}
+
+	/**
+	 * Reuse results of blueprint pure methods of a bound object that the page calls with the same arguments during a frame.
+	 * Results are dropped at the next frame, when the page calls another method of the object, or after InvalidateUObject.
+	 *
+	 * @param Object The object whose results are kept.
+	 * @param bMemoize Whether to keep results.
+	 */
+	virtual void SetUObjectMemoized(UObject* Object, bool bMemoize) {}
+
+	/**
+	 * Send float, int32, uint8 and FVector arrays returned by methods of a bound object as typed arrays.
+	 * The page receives a Float32Array, Int32Array or Uint8Array instead of a plain array, FVector arrays become a Float32Array of x, y, z.
+	 *
+	 * @param Object The object whose methods return typed arrays.
+	 * @param bTypedArrays Whether to send typed arrays.
+	 */
+	virtual void SetUObjectTypedArrays(UObject* Object, bool bTypedArrays) {}
+
+	/** Drop the results kept for a bound object. */
+	virtual void InvalidateUObject(UObject* Object) {}
+
 	/**
 	 * Close this window so that it can no longer be used.
 	 *
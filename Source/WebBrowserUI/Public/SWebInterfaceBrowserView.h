@@ -17,6 +17,7 @@ class IWebInterfaceBrowserDialog;
 class IWebInterfaceBrowserPopupFeatures;
 class IWebInterfaceBrowserWindow;
 struct FWebNavigationRequest;
+struct FWebInterfaceJSParam;
 enum class EWebInterfaceBrowserDialogEventResponse;
 enum class EWebInterfaceBrowserDocumentState;
 enum class EWebInterfaceBrowserConsoleLogSeverity;
@@ -240,6 +241,41 @@ public:
 	/** Execute javascript on the current window */
 	void ExecuteJavascript(const FString& ScriptText);
 
+	/**
+	 * Call ue.interface[Function] on the current window without compiling a script.
+	 *
+	 * @return false if the call couldn't be delivered this way, and ExecuteJavascript should be used instead.
+	 */
+	bool CallJavascriptFunction(const FString& Function, const FWebInterfaceJSParam* Data);
+
+	/**
+	 * Call several ue.interface functions on the current window with a single message.
+	 *
+	 * @return false if the calls couldn't be delivered this way, and ExecuteJavascript should be used instead.
+	 */
+	bool CallJavascriptBatch(const FWebInterfaceJSParam& Calls);
+
+	/** Send changes to properties of a bound object to the current window, see IWebInterfaceBrowserWindow::ObserveUObject. */
+	void ObserveUObject(const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame = true);
+
+	/** Stop sending property changes for an object. */
+	void UnobserveUObject(const FString& Name, UObject* Object = nullptr);
+
+	/** Check the observed properties of an object for changes at the end of the frame. */
+	void MarkUObjectDirty(UObject* Object);
+
+	/** Run methods of a bound object on a worker thread, see IWebInterfaceBrowserWindow::SetUObjectAsyncMethods. */
+	void SetUObjectAsyncMethods(UObject* Object, const TArray<FName>& Methods);
+
+	/** Reuse results of pure methods of a bound object during a frame, see IWebInterfaceBrowserWindow::SetUObjectMemoized. */
+	void SetUObjectMemoized(UObject* Object, bool bMemoize);
+
+	/** Send numeric arrays returned by methods of a bound object as typed arrays, see IWebInterfaceBrowserWindow::SetUObjectTypedArrays. */
+	void SetUObjectTypedArrays(UObject* Object, bool bTypedArrays);
+
+	/** Drop the results kept for a bound object. */
+	void InvalidateUObject(UObject* Object);
+
 	/**
 	 * Gets the source of the main frame as raw HTML.
 	 *
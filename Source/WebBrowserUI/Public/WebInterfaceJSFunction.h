@@ -9,6 +9,7 @@
 #include "Internationalization/Text.h"
 #include "Misc/Guid.h"
 #include "Templates/EnableIf.h"
+#include "Templates/Function.h"
 #include "Templates/IsPointer.h"
 #include "Templates/SharedPointer.h"
 #include "UObject/Class.h"
@@ -54,6 +55,35 @@ struct WEBBROWSERUI_API FWebInterfaceJSParam
 		}
 	};
 
+	/**
+	 * Numeric array data sent as a single block instead of one value per element.
+	 * The page receives it as { $typedarray, $data }, which the dispatcher turns into a typed array in ue.interface calls,
+	 * in callbacks passed to methods of permanently bound objects, and in the results of those methods.
+	 * Arrays are only sent this way when wrapped explicitly, e.g. FWebInterfaceJSParam(FWebInterfaceJSParam::FTypedArray(Floats)),
+	 * or when returned from methods of an object set with IWebInterfaceBrowserWindow::SetUObjectTypedArrays.
+	 */
+	struct WEBBROWSERUI_API FTypedArray
+	{
+		enum EType { Float32, Int32, Uint8 } Type;
+		TArray<uint8> Data;
+
+		FTypedArray() : Type(Uint8) {}
+		explicit FTypedArray(const TArray<float>& Value);
+		explicit FTypedArray(const TArray<int32>& Value);
+		explicit FTypedArray(const TArray<uint8>& Value);
+		/** Vectors are flattened to x, y, z floats. */
+		explicit FTypedArray(const TArray<FVector>& Value);
+
+		/** The number of elements. */
+		int32 Num() const;
+		/** Read an element as a number. */
+		double GetValue(int32 Index) const;
+		/** The name of the typed array in JS, without the Array suffix. */
+		const TCHAR* GetTypeName() const;
+		/** Find the type from its name in JS, returns false if the name is unknown. */
+		static bool FindType(const FString& Name, EType& OutType);
+	};
+
 	FWebInterfaceJSParam() : Tag(PTYPE_NULL) {}
 	FWebInterfaceJSParam(bool Value) : Tag(PTYPE_BOOL), BoolValue(Value) {}
 	FWebInterfaceJSParam(int8 Value) : Tag(PTYPE_INT), IntValue(Value) {}
@@ -76,6 +106,8 @@ struct WEBBROWSERUI_API FWebInterfaceJSParam
 		: Tag(PTYPE_STRUCT)
 		, StructValue(new FStructWrapper<T>(Value))
 	{}
+	FWebInterfaceJSParam(const FTypedArray& Value) : Tag(PTYPE_TYPED_ARRAY), TypedArrayValue(new FTypedArray(Value)) {}
+	FWebInterfaceJSParam(FTypedArray&& Value) : Tag(PTYPE_TYPED_ARRAY), TypedArrayValue(new FTypedArray(MoveTemp(Value))) {}
 	template <typename T> FWebInterfaceJSParam(const TArray<T>& Value)
 		: Tag(PTYPE_ARRAY)
 	{
@@ -110,7 +142,10 @@ struct WEBBROWSERUI_API FWebInterfaceJSParam
 	FWebInterfaceJSParam(FWebInterfaceJSParam&& Other);
 	~FWebInterfaceJSParam();
 
-	enum { PTYPE_NULL, PTYPE_BOOL, PTYPE_INT, PTYPE_DOUBLE, PTYPE_STRING, PTYPE_OBJECT, PTYPE_STRUCT, PTYPE_ARRAY, PTYPE_MAP } Tag;
+	/** Whether this value contains a typed array, at any depth. */
+	bool HasTypedArray() const;
+
+	enum { PTYPE_NULL, PTYPE_BOOL, PTYPE_INT, PTYPE_DOUBLE, PTYPE_STRING, PTYPE_OBJECT, PTYPE_STRUCT, PTYPE_ARRAY, PTYPE_MAP, PTYPE_TYPED_ARRAY } Tag;
 	union
 	{
 		bool BoolValue;
@@ -121,10 +156,32 @@ struct WEBBROWSERUI_API FWebInterfaceJSParam
 		IStructWrapper* StructValue;
 		TArray<FWebInterfaceJSParam>* ArrayValue;
 		TMap<FString, FWebInterfaceJSParam>* MapValue;
+		FTypedArray* TypedArrayValue;
 	};
 
 };
 
+/**
+ * Registry of readers for structs that are filled from script values as a whole, instead of property by property.
+ * UFunction arguments of a registered struct type receive the value passed from JS converted to a FWebInterfaceJSParam.
+ * Readers are only used on the game thread.
+ */
+struct WEBBROWSERUI_API FWebInterfaceJSStructReader
+{
+	typedef TFunction<void (const FWebInterfaceJSParam& Value, void* StructPtr)> FReader;
+
+	/** Register a reader for a struct type, replacing any existing one. */
+	static void Register(const UScriptStruct* Struct, FReader Reader);
+	/** Remove the reader for a struct type. */
+	static void Unregister(const UScriptStruct* Struct);
+	/** Find the reader for a struct type, if any. */
+	static const FReader* Find(const UScriptStruct* Struct);
+
+private:
+
+	static TMap<const UScriptStruct*, FReader>& GetReaders();
+};
+
 class FWebInterfaceJSScripting;
 
 /** Base class for JS callback objects. */
@@ -140,6 +197,11 @@ struct WEBBROWSERUI_API FWebInterfaceJSCallbackBase
 		return ScriptingPtr.IsValid();
 	}
 
+	/** The id the page knows this callback by. */
+	const FGuid& GetCallbackId() const
+	{
+		return CallbackId;
+	}
 
 protected:
 	FWebInterfaceJSCallbackBase(TSharedPtr<FWebInterfaceJSScripting> InScripting, const FGuid& InCallbackId)
@@ -188,6 +250,7 @@ struct WEBBROWSERUI_API FWebInterfaceJSFunction
  *  Pass a result or error back by invoking Success or Failure on the object.
  *  UFunctions accepting a FWebInterfaceJSResponse should have a void return type, as any value returned from the function will be ignored.
  *  Calling the response methods does not have to happen before returning from the function, which means you can use this to implement asynchronous functionality.
+ *  Responses of methods run on a worker thread can also be called from other threads, the result is sent to the page from the game thread.
  *
  *  Note that the remote object will become invalid as soon as a result has been delivered, so you can only call either Success or Failure once.
  */
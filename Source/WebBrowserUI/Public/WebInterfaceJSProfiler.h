@@ -0,0 +1,91 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#if UE_VERSION >= 425
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#endif
+
+DECLARE_STATS_GROUP(TEXT("WebUIBridge"), STATGROUP_WebUIBridge, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Arguments"), STAT_WebUIBridgeDecode, STATGROUP_WebUIBridge, WEBBROWSERUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Process Event"), STAT_WebUIBridgeProcess, STATGROUP_WebUIBridge, WEBBROWSERUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Encode Result"), STAT_WebUIBridgeEncode, STATGROUP_WebUIBridge, WEBBROWSERUI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dispatch Event"), STAT_WebUIBridgeEvent, STATGROUP_WebUIBridge, WEBBROWSERUI_API);
+
+#if UE_VERSION >= 425
+#define WEBUI_BRIDGE_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE(Name)
+#else
+#define WEBUI_BRIDGE_TRACE_SCOPE(Name)
+#endif
+
+/** Times a phase (Decode, Process, Encode or Event) of a bridge call for stat WebUIBridge, Unreal Insights and the profiler. */
+#define WEBUI_BRIDGE_SCOPE(Phase, Name) \
+	SCOPE_CYCLE_COUNTER(STAT_WebUIBridge##Phase); \
+	WEBUI_BRIDGE_TRACE_SCOPE(WebUIBridge_##Phase); \
+	FWebInterfaceJSProfiler::FScope PREPROCESSOR_JOIN(WebUIBridgeScope, __LINE__)(Name, FWebInterfaceJSProfiler::EPhase::Phase)
+
+/**
+ * Records calls between the page and the engine, by bound method and by event name.
+ *
+ * Recording is off until WebUI.Bridge.Profile is set, WebUI.Bridge.Dump [Count] [Calls|Time|Bytes|Latency] logs the entries
+ * that cost the most and WebUI.Bridge.Reset forgets them. Only used on the game thread.
+ */
+class WEBBROWSERUI_API FWebInterfaceJSProfiler
+{
+public:
+
+	enum class EPhase : uint8
+	{
+		Decode,
+		Process,
+		Encode,
+		Event,
+		Num
+	};
+
+	/** Whether calls are being recorded. */
+	static bool IsEnabled();
+
+	/** Count a call to a bound method, with the size of its arguments. */
+	static void AddCall(FName Name, int32 ArgumentBytes);
+	/** Count an event sent by the page, with the size of its data. */
+	static void AddEvent(FName Name, int32 DataBytes);
+	/** Add the time spent on a phase of a call or event. */
+	static void AddTime(FName Name, EPhase Phase, uint64 Cycles);
+	/** Add a result sent back to the page, with the time since the call was received. */
+	static void AddResult(FName Name, int32 ResultBytes, double Latency);
+
+	/** Log the most expensive entries. */
+	static void Dump(int32 Count, const FString& SortBy);
+	/** Forget everything recorded so far. */
+	static void Reset();
+
+	/** Adds the time it is in scope to a phase, while recording. */
+	class FScope
+	{
+	public:
+
+		FScope(FName InName, EPhase InPhase)
+			: Name(InName)
+			, Phase(InPhase)
+			, StartCycles(IsEnabled() ? FPlatformTime::Cycles64() : 0)
+		{
+		}
+
+		~FScope()
+		{
+			if (StartCycles)
+			{
+				AddTime(Name, Phase, FPlatformTime::Cycles64() - StartCycles);
+			}
+		}
+
+	private:
+
+		FName Name;
+		EPhase Phase;
+		uint64 StartCycles;
+	};
+};
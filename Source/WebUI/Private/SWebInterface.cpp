@@ -683,6 +683,64 @@ void SWebInterface::ExecuteJavascript( const FString& ScriptText )
 		BrowserView->ExecuteJavascript( ScriptText );
 }
 
+bool SWebInterface::CallJavascriptFunction( const FString& Function, const FWebInterfaceJSParam* Data )
+{
+	if ( BrowserView.IsValid() )
+		return BrowserView->CallJavascriptFunction( Function, Data );
+
+	return false;
+}
+
+bool SWebInterface::CallJavascriptBatch( const FWebInterfaceJSParam& Calls )
+{
+	if ( BrowserView.IsValid() )
+		return BrowserView->CallJavascriptBatch( Calls );
+
+	return false;
+}
+
+void SWebInterface::ObserveUObject( const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame )
+{
+	if ( BrowserView.IsValid() )
+		BrowserView->ObserveUObject( Name, Object, Properties, bEveryFrame );
+}
+
+void SWebInterface::UnobserveUObject( const FString& Name, UObject* Object )
+{
+	if ( BrowserView.IsValid() )
+		BrowserView->UnobserveUObject( Name, Object );
+}
+
+void SWebInterface::MarkUObjectDirty( UObject* Object )
+{
+	if ( BrowserView.IsValid() )
+		BrowserView->MarkUObjectDirty( Object );
+}
+
+void SWebInterface::SetUObjectAsyncMethods( UObject* Object, const TArray<FName>& Methods )
+{
+	if ( BrowserView.IsValid() )
+		BrowserView->SetUObjectAsyncMethods( Object, Methods );
+}
+
+void SWebInterface::SetUObjectMemoized( UObject* Object, bool bMemoize )
+{
+	if ( BrowserView.IsValid() )
+		BrowserView->SetUObjectMemoized( Object, bMemoize );
+}
+
+void SWebInterface::SetUObjectTypedArrays( UObject* Object, bool bTypedArrays )
+{
+	if ( BrowserView.IsValid() )
+		BrowserView->SetUObjectTypedArrays( Object, bTypedArrays );
+}
+
+void SWebInterface::InvalidateUObject( UObject* Object )
+{
+	if ( BrowserView.IsValid() )
+		BrowserView->InvalidateUObject( Object );
+}
+
 void SWebInterface::BindUObject( const FString& Name, UObject* Object, bool bIsPermanent )
 {
 	if ( BrowserView.IsValid() )
@@ -1,7 +1,8 @@
 // Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
 #include "WebInterface.h"
 #include "WebInterfaceObject.h"
-#include "PlatformHttp.h"
+#include "WebInterfaceSettings.h"
+#include "WebInterfaceHashDecoder.h"
 #include "Engine/GameInstance.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/LocalPlayer.h"
@@ -17,10 +18,73 @@
 
 #if !UE_SERVER
 #include "SWebInterface.h"
+#include "WebInterfaceBrowserModule.h"
+#include "IWebInterfaceBrowserSingleton.h"
+#include "WebInterfaceConvert.h"
+#include "WebInterfaceJSProfiler.h"
 #endif
 
 #define LOCTEXT_NAMESPACE "WebInterface"
 
+namespace
+{
+	// waiting broadcasts kept for a rate limited event without its own limit
+	const int32 DefaultMaxQueuedEvents = 64;
+
+	// Copy objects and arrays, so changes made after a call is queued don't reach the page.
+	FJsonLibraryValue SnapshotData( const FJsonLibraryValue& Data )
+	{
+		if ( Data.GetType() == EJsonLibraryType::Object || Data.GetType() == EJsonLibraryType::Array )
+			return Data.Copy();
+
+		return Data;
+	}
+
+#if !UE_SERVER
+	// Count the characters from Start that fit in MaxBytes once encoded as UTF-8, surrogate pairs are never split
+	int32 FitUtf8( const FString& Text, int32 Start, int32 MaxBytes, int32& Bytes )
+	{
+		const TCHAR* Data   = *Text;
+		const int32  Length = Text.Len();
+
+		int32 Index = Start;
+		Bytes = 0;
+
+		while ( Index < Length )
+		{
+			const uint32 Char = Data[ Index ];
+
+			int32 Size  = Char < 0x80 ? 1 : Char < 0x800 ? 2 : 3;
+			int32 Count = 1;
+			if ( ( Char & 0xFC00 ) == 0xD800 && Index + 1 < Length && ( Data[ Index + 1 ] & 0xFC00 ) == 0xDC00 )
+			{
+				Size  = 4;
+				Count = 2;
+			}
+
+			if ( Bytes + Size > MaxBytes )
+				break;
+
+			Bytes += Size;
+			Index += Count;
+		}
+
+		return Index - Start;
+	}
+
+	FString GetCallScript( const FString& Function, const FJsonLibraryValue& Data )
+	{
+		if ( Data.GetType() != EJsonLibraryType::Invalid )
+			return FString::Printf( TEXT( "typeof ue != 'undefined' && typeof ue.interface != 'undefined' && ue.interface[%s](%s)" ),
+				*FJsonLibraryValue( Function ).Stringify(),
+				*Data.Stringify() );
+
+		return FString::Printf( TEXT( "typeof ue != 'undefined' && typeof ue.interface != 'undefined' && ue.interface[%s]()" ),
+			*FJsonLibraryValue( Function ).Stringify() );
+	}
+#endif
+}
+
 UWebInterface::UWebInterface( const FObjectInitializer& ObjectInitializer )
 	: Super( ObjectInitializer )
 {
@@ -40,6 +104,17 @@ UWebInterface::UWebInterface( const FObjectInitializer& ObjectInitializer )
 
 	bAcceleratedPaint = true;
 	bCustomCursors    = false;
+	bBatchCalls       = false;
+	bStateInstalled   = false;
+
+	BulkBudget = 0;
+	NextBulkId = 0;
+
+	EventBudget = 0.0f;
+	EventFrame  = 0;
+	EventTime   = 0.0;
+
+	bDispatchingEvents = false;
 }
 
 bool UWebInterface::Load( const FString& File )
@@ -130,28 +205,283 @@ FString UWebInterface::GetURL() const
 void UWebInterface::Execute( const FString& Script )
 {
 #if !UE_SERVER
-	if ( WebInterfaceWidget.IsValid() )
+	if ( !WebInterfaceWidget.IsValid() )
+		return;
+
+	if ( bBatchCalls )
+		Enqueue( Script, FJsonLibraryValue(), true, false );
+	else
 		WebInterfaceWidget->ExecuteJavascript( Script );
 #endif
 }
 
-void UWebInterface::Call( const FString& Function, const FJsonLibraryValue& Data )
+void UWebInterface::Call( const FString& Function, const FJsonLibraryValue& Data, bool bCoalesce /*= false*/, EWebInterfacePriority Priority /*= EWebInterfacePriority::Normal*/ )
+{
+	// reserved
+	if ( Function == "broadcast" || Function == "broadcastdata" )
+		return;
+
+#if !UE_SERVER
+	if ( !WebInterfaceWidget.IsValid() )
+		return;
+
+	if ( Priority == EWebInterfacePriority::Bulk )
+	{
+		EnqueueBulk( Function, Data, bCoalesce );
+		return;
+	}
+
+	// high priority calls skip the queue
+	if ( bBatchCalls && Priority != EWebInterfacePriority::High )
+	{
+		Enqueue( Function, Data, false, bCoalesce );
+		return;
+	}
+
+	// callbacks resolved before this call reach the page before it
+	if ( PendingResolves.Num() > 0 )
+		FlushResolves();
+
+	SendCall( Function, Data );
+#endif
+}
+
+void UWebInterface::SendCall( const FString& Function, const FJsonLibraryValue& Data )
+{
+#if !UE_SERVER
+	// send native values when the page has attached, this avoids compiling a script for every call
+	if ( Data.GetType() != EJsonLibraryType::Invalid )
+	{
+		FWebInterfaceJSParam Param = FWebInterfaceConvert::ToScriptParam( Data );
+		if ( WebInterfaceWidget->CallJavascriptFunction( Function, &Param ) )
+			return;
+	}
+	else if ( WebInterfaceWidget->CallJavascriptFunction( Function, nullptr ) )
+		return;
+
+	WebInterfaceWidget->ExecuteJavascript( GetCallScript( Function, Data ) );
+#endif
+}
+
+void UWebInterface::CallTypedArray( const FString& Function, const TArray<float>& Data )
+{
+#if !UE_SERVER
+	FWebInterfaceJSParam Param = FWebInterfaceJSParam::FTypedArray( Data );
+	SendTypedArray( Function, Param );
+#endif
+}
+
+void UWebInterface::CallTypedArray( const FString& Function, const TArray<int32>& Data )
+{
+#if !UE_SERVER
+	FWebInterfaceJSParam Param = FWebInterfaceJSParam::FTypedArray( Data );
+	SendTypedArray( Function, Param );
+#endif
+}
+
+void UWebInterface::CallTypedArray( const FString& Function, const TArray<uint8>& Data )
+{
+#if !UE_SERVER
+	FWebInterfaceJSParam Param = FWebInterfaceJSParam::FTypedArray( Data );
+	SendTypedArray( Function, Param );
+#endif
+}
+
+void UWebInterface::CallTypedArray( const FString& Function, const TArray<FVector>& Data )
+{
+#if !UE_SERVER
+	FWebInterfaceJSParam Param = FWebInterfaceJSParam::FTypedArray( Data );
+	SendTypedArray( Function, Param );
+#endif
+}
+
+void UWebInterface::SendTypedArray( const FString& Function, FWebInterfaceJSParam& Data )
 {
 	// reserved
-	if ( Function == "broadcast" )
+	if ( Function == "broadcast" || Function == "broadcastdata" )
 		return;
 
 #if !UE_SERVER
 	if ( !WebInterfaceWidget.IsValid() )
 		return;
 
+	// typed arrays aren't queued, so calls and callbacks from earlier in the frame go first
+	if ( bBatchCalls )
+		Flush();
+
+	if ( PendingResolves.Num() > 0 )
+		FlushResolves();
+
+	// the dispatcher restores the typed array on the page
+	if ( WebInterfaceWidget->CallJavascriptFunction( Function, &Data ) )
+		return;
+
+	WebInterfaceWidget->ExecuteJavascript( FString::Printf( TEXT( "typeof ue != 'undefined' && typeof ue.interface != 'undefined' && ue.interface[%s](new %sArray(%s))" ),
+		*FJsonLibraryValue( Function ).Stringify(),
+		Data.TypedArrayValue->GetTypeName(),
+		*FWebInterfaceConvert::FromScriptParam( Data ).Stringify() ) );
+#endif
+}
+
+int32 UWebInterface::RegisterScript( const FString& Name, const FString& Source )
+{
+	int32 Handle = FindScript( Name );
+	if ( Handle >= 0 )
+		Scripts[ Handle ].Source = Source;
+	else
+		Handle = Scripts.Add( FWebInterfaceScript{ Name, Source } );
+
+	// pages that are already loaded get it now, later pages when they load
+	InstallScripts( Handle, Handle );
+	return Handle;
+}
+
+int32 UWebInterface::FindScript( const FString& Name ) const
+{
+	return Scripts.IndexOfByPredicate( [ &Name ]( const FWebInterfaceScript& Script ) { return Script.Name == Name; } );
+}
+
+void UWebInterface::InvokeScript( int32 Handle, const FJsonLibraryValue& Data )
+{
+	if ( !Scripts.IsValidIndex( Handle ) )
+		return;
+
+	TArray<FJsonLibraryValue> Array;
+	Array.Add( Handle );
 	if ( Data.GetType() != EJsonLibraryType::Invalid )
-		WebInterfaceWidget->ExecuteJavascript( FString::Printf( TEXT( "typeof ue != 'undefined' && typeof ue.interface != 'undefined' && ue.interface[%s](%s)" ),
-			*FJsonLibraryValue( Function ).Stringify(),
-			*Data.Stringify() ) );
+		Array.Add( Data );
+
+	Call( "$script", FJsonLibraryValue( Array ) );
+}
+
+void UWebInterface::InstallScripts( int32 First /*= 0*/, int32 Last /*= INDEX_NONE*/ )
+{
+	if ( Last == INDEX_NONE )
+		Last = Scripts.Num() - 1;
+	if ( !Scripts.IsValidIndex( First ) || !Scripts.IsValidIndex( Last ) )
+		return;
+
+#if !UE_SERVER
+	if ( !WebInterfaceWidget.IsValid() )
+		return;
+
+	// ue.interface.$script([handle, data]) calls a script, so the dispatcher can reach it like any other function
+	// ue.interface is created if the page hasn't defined it yet, pages that add functions to it keep the scripts
+	FString Script = TEXT( "typeof ue != 'undefined' && (function(){ var s = ue['$scripts'] = ue['$scripts'] || []; if (typeof ue.interface == 'undefined') ue.interface = {}; " )
+		TEXT( "if (typeof ue.interface['$script'] != 'function') ue.interface['$script'] = function(m){ if (typeof s[m[0]] == 'function') return s[m[0]](m[1]); };\n" );
+
+	for ( int32 Handle = First; Handle <= Last; Handle++ )
+		Script += FString::Printf( TEXT( "s[%d] = function(data){\n%s\n};\n" ), Handle, *Scripts[ Handle ].Source );
+
+	Script += TEXT( "})();" );
+
+	// installed right away, a batched script would turn the whole batch back into one joined script
+	WebInterfaceWidget->ExecuteJavascript( Script );
+#endif
+}
+
+void UWebInterface::SetBatching( bool bEnable )
+{
+	if ( bBatchCalls && !bEnable )
+		Flush();
+
+	bBatchCalls = bEnable;
+}
+
+bool UWebInterface::IsBatching() const
+{
+	return bBatchCalls;
+}
+
+void UWebInterface::Flush()
+{
+#if !UE_SERVER
+	if ( FlushHandle.IsValid() )
+	{
+		if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+			IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().Remove( FlushHandle );
+
+		FlushHandle.Reset();
+	}
+
+	if ( QueuedCalls.Num() <= 0 )
+		return;
+
+	if ( PendingResolves.Num() > 0 )
+		FlushResolves();
+
+	TArray<FWebInterfaceQueuedCall> Calls = MoveTemp( QueuedCalls );
+	QueuedCalls.Reset();
+	CoalescedCalls.Reset();
+
+	if ( !WebInterfaceWidget.IsValid() )
+		return;
+
+	// send all calls as a single message, unless scripts have to run in between them
+	bool bScripts = false;
+	for ( const FWebInterfaceQueuedCall& Call : Calls )
+		bScripts |= Call.bScript;
+
+	if ( !bScripts )
+	{
+		FWebInterfaceJSParam Batch;
+		Batch.Tag        = FWebInterfaceJSParam::PTYPE_ARRAY;
+		Batch.ArrayValue = new TArray<FWebInterfaceJSParam>();
+		Batch.ArrayValue->Reserve( Calls.Num() );
+
+		for ( const FWebInterfaceQueuedCall& Call : Calls )
+		{
+			FWebInterfaceJSParam Entry;
+			Entry.Tag        = FWebInterfaceJSParam::PTYPE_ARRAY;
+			Entry.ArrayValue = new TArray<FWebInterfaceJSParam>();
+			Entry.ArrayValue->Add( FWebInterfaceJSParam( Call.Function ) );
+
+			if ( Call.Data.GetType() != EJsonLibraryType::Invalid )
+				Entry.ArrayValue->Add( FWebInterfaceConvert::ToScriptParam( Call.Data ) );
+
+			Batch.ArrayValue->Add( MoveTemp( Entry ) );
+		}
+
+		if ( WebInterfaceWidget->CallJavascriptBatch( Batch ) )
+			return;
+	}
+
+	// otherwise join everything into one script, in the order it was queued
+	FString Script;
+	for ( const FWebInterfaceQueuedCall& Call : Calls )
+	{
+		Script += Call.bScript ? Call.Function : GetCallScript( Call.Function, Call.Data );
+		Script += TEXT( ";\n" );
+	}
+
+	WebInterfaceWidget->ExecuteJavascript( Script );
+#endif
+}
+
+void UWebInterface::Enqueue( const FString& Function, const FJsonLibraryValue& Data, bool bScript, bool bCoalesce )
+{
+	// latest wins, but the call keeps its place in the queue
+	if ( bCoalesce )
+	{
+		if ( const int32* Index = CoalescedCalls.Find( Function ) )
+		{
+			QueuedCalls[ *Index ].Data = SnapshotData( Data );
+			return;
+		}
+
+		CoalescedCalls.Add( Function, QueuedCalls.Num() );
+	}
+
+	QueuedCalls.Add( FWebInterfaceQueuedCall{ Function, SnapshotData( Data ), bScript } );
+
+#if !UE_SERVER
+	if ( FlushHandle.IsValid() )
+		return;
+
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+		FlushHandle = IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().AddUObject( this, &UWebInterface::Flush );
 	else
-		WebInterfaceWidget->ExecuteJavascript( FString::Printf( TEXT( "typeof ue != 'undefined' && typeof ue.interface != 'undefined' && ue.interface[%s]()" ),
-			*FJsonLibraryValue( Function ).Stringify() ) );
+		Flush();
 #endif
 }
 
@@ -185,6 +515,357 @@ void UWebInterface::Unbind( const FString& Name, UObject* Object )
 #endif
 }
 
+void UWebInterface::Observe( const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame /*= true*/ )
+{
+	if ( !Object )
+		return;
+
+	// reserved
+	if ( Name.ToLower() == "interface" )
+		return;
+
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->ObserveUObject( Name, Object, Properties, bEveryFrame );
+#endif
+}
+
+void UWebInterface::Unobserve( const FString& Name, UObject* Object )
+{
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->UnobserveUObject( Name, Object );
+#endif
+}
+
+void UWebInterface::MarkDirty( UObject* Object )
+{
+	if ( !Object )
+		return;
+
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->MarkUObjectDirty( Object );
+#endif
+}
+
+void UWebInterface::SetAsync( UObject* Object, const TArray<FName>& Methods )
+{
+	if ( !Object )
+		return;
+
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->SetUObjectAsyncMethods( Object, Methods );
+#endif
+}
+
+void UWebInterface::SetMemoized( UObject* Object, bool bMemoize )
+{
+	if ( !Object )
+		return;
+
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->SetUObjectMemoized( Object, bMemoize );
+#endif
+}
+
+void UWebInterface::SetTypedArrays( UObject* Object, bool bTypedArrays )
+{
+	if ( !Object )
+		return;
+
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->SetUObjectTypedArrays( Object, bTypedArrays );
+#endif
+}
+
+void UWebInterface::InvalidateBinding( UObject* Object )
+{
+	if ( !Object )
+		return;
+
+#if !UE_SERVER
+	if ( WebInterfaceWidget.IsValid() )
+		WebInterfaceWidget->InvalidateUObject( Object );
+#endif
+}
+
+void UWebInterface::BindEvent( FName Name, FOnNamedInterfaceEvent Event )
+{
+	if ( !Event.IsBound() )
+		return;
+
+	TSharedRef<FEventHandlers>* Handlers = EventHandlers.Find( Name );
+	if ( !Handlers )
+		Handlers = &EventHandlers.Add( Name, MakeShared<FEventHandlers>() );
+
+	( *Handlers )->Events.AddUnique( Event );
+}
+
+void UWebInterface::UnbindEvent( FName Name, FOnNamedInterfaceEvent Event )
+{
+	TSharedRef<FEventHandlers>* Handlers = EventHandlers.Find( Name );
+	if ( !Handlers )
+		return;
+
+	( *Handlers )->Events.Remove( Event );
+	if ( ( *Handlers )->Events.Num() == 0 && !( *Handlers )->NativeEvents.IsBound() )
+		EventHandlers.Remove( Name );
+}
+
+void UWebInterface::SetEventPolicy( FName Name, const FWebInterfaceEventPolicy& Policy )
+{
+	EventPolicies.Add( Name, Policy );
+}
+
+void UWebInterface::ClearEventPolicy( FName Name )
+{
+	EventPolicies.Remove( Name );
+}
+
+void UWebInterface::Resolve( const FString& Callback, const FJsonLibraryValue& Data )
+{
+#if !UE_SERVER
+	if ( !WebInterfaceWidget.IsValid() )
+		return;
+
+	// pooled callbacks are "#index.generation.page", the generation keeps a stale callback from reaching a reused slot,
+	// and the page keeps one from an earlier page from reaching the same slot after a reload
+	TArray<FString> Parts;
+	if ( !Callback.StartsWith( "#" ) || Callback.RightChop( 1 ).ParseIntoArray( Parts, TEXT( "." ) ) != 3 )
+	{
+		// named callbacks don't need the resolver, which may not have been installed if the page wasn't ready
+		Call( Callback, Data );
+		return;
+	}
+
+	TArray<FJsonLibraryValue> Entry;
+	Entry.Add( FCString::Atoi( *Parts[ 0 ] ) );
+	Entry.Add( FCString::Atoi( *Parts[ 1 ] ) );
+	Entry.Add( FCString::Atoi( *Parts[ 2 ] ) );
+
+	if ( Data.GetType() != EJsonLibraryType::Invalid )
+		Entry.Add( SnapshotData( Data ) );
+
+	PendingResolves.Add( FJsonLibraryValue( Entry ) );
+	if ( ResolveHandle.IsValid() )
+		return;
+
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+		ResolveHandle = IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().AddUObject( this, &UWebInterface::FlushResolves );
+	else
+		FlushResolves();
+#endif
+}
+
+void UWebInterface::InstallResolver()
+{
+#if !UE_SERVER
+	if ( !WebInterfaceWidget.IsValid() )
+		return;
+
+	// ue.interface.$callback(fn) keeps a one time callback in a pooled slot and returns its id for broadcasts
+	// ue.interface.$resolve([[index, generation, page, data], ...]) calls them, pooled slots are freed once called
+	WebInterfaceWidget->ExecuteJavascript( TEXT( "typeof ue != 'undefined' && (function(){ if (typeof ue.interface == 'undefined') ue.interface = {}; if (typeof ue.interface['$resolve'] == 'function') return; " )
+		TEXT( "var c = [], g = [], f = [], p = Math.floor(Math.random() * 1000000000); " )
+		TEXT( "ue.interface['$callback'] = function(h){ var i = f.length ? f.pop() : c.length; c[i] = h; g[i] = (g[i] || 0) + 1; return '#' + i + '.' + g[i] + '.' + p; }; " )
+		TEXT( "ue.interface['$resolve'] = function(m){ m.forEach(function(r){ var i = r[0], h = c[i]; if (g[i] !== r[1] || p !== r[2] || !h) return; c[i] = null; f.push(i); h(r[3]); }); }; })();" ) );
+#endif
+}
+
+void UWebInterface::FlushResolves()
+{
+#if !UE_SERVER
+	if ( ResolveHandle.IsValid() )
+	{
+		if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+			IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().Remove( ResolveHandle );
+
+		ResolveHandle.Reset();
+	}
+
+	if ( PendingResolves.Num() <= 0 )
+		return;
+
+	TArray<FJsonLibraryValue> Resolves = MoveTemp( PendingResolves );
+	PendingResolves.Reset();
+
+	if ( !WebInterfaceWidget.IsValid() )
+		return;
+
+	// a single call with native values, so nothing has to be compiled on the page
+	// pooled callbacks only exist once the page has the resolver, so it doesn't have to be installed here
+	SendCall( "$resolve", FJsonLibraryValue( Resolves ) );
+#endif
+}
+
+void UWebInterface::SetEventBudget( float Milliseconds )
+{
+	EventBudget = FMath::Max( Milliseconds, 0.0f );
+}
+
+void UWebInterface::SetBulkBudget( int32 Kilobytes )
+{
+	BulkBudget = FMath::Max( Kilobytes, 0 );
+}
+
+int32 UWebInterface::GetBulkBudget() const
+{
+	if ( BulkBudget > 0 )
+		return BulkBudget;
+
+	return FMath::Max( GetDefault<UWebInterfaceSettings>()->BulkBudget, 1 );
+}
+
+void UWebInterface::EnqueueBulk( const FString& Function, const FJsonLibraryValue& Data, bool bCoalesce )
+{
+	const FString Text = Data.GetType() != EJsonLibraryType::Invalid ? Data.Stringify() : FString();
+
+	// latest wins while none of it has been sent
+	if ( bCoalesce )
+	{
+		for ( FWebInterfaceBulkCall& Bulk : BulkCalls )
+		{
+			if ( Bulk.Offset == 0 && Bulk.Function == Function )
+			{
+				Bulk.Text = Text;
+				return;
+			}
+		}
+	}
+
+	BulkCalls.Add( FWebInterfaceBulkCall{ NextBulkId++, Function, Text, 0 } );
+
+#if !UE_SERVER
+	if ( BulkHandle.IsValid() )
+		return;
+
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+		BulkHandle = IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().AddUObject( this, &UWebInterface::SendBulk );
+	else
+		while ( BulkCalls.Num() > 0 )
+			SendBulk();
+#endif
+}
+
+void UWebInterface::SendBulk()
+{
+#if !UE_SERVER
+	if ( !WebInterfaceWidget.IsValid() )
+		BulkCalls.Reset();
+
+	// slices are bounded, so calls made in between only wait behind a frame's budget
+	const int32 SliceSize = 64 * 1024;
+	int32 Budget = GetBulkBudget() * 1024;
+
+	while ( BulkCalls.Num() > 0 && Budget > 0 )
+	{
+		FWebInterfaceBulkCall& Bulk = BulkCalls[ 0 ];
+
+		int32 Bytes = 0;
+		const int32 Length = FitUtf8( Bulk.Text, Bulk.Offset, FMath::Min( SliceSize, Budget ), Bytes );
+
+		// the rest of the budget is too small for the next character
+		if ( Length <= 0 && Bulk.Offset < Bulk.Text.Len() )
+			break;
+
+		// installed with the first slice of every call, so a page that wasn't ready for an earlier one gets it now
+		// ue.interface.$bulk([id, function, text, last]) joins the slices of a call, then calls the function with the parsed data
+		if ( Bulk.Offset == 0 )
+			WebInterfaceWidget->ExecuteJavascript( TEXT( "typeof ue != 'undefined' && (function(){ if (typeof ue.interface == 'undefined') ue.interface = {}; if (typeof ue.interface['$bulk'] == 'function') return; var p = {}; " )
+				TEXT( "ue.interface['$bulk'] = function(m){ p[m[0]] = (p[m[0]] || '') + m[2]; if (!m[3]) return; var t = p[m[0]]; delete p[m[0]]; " )
+				TEXT( "if (typeof ue.interface[m[1]] == 'function') t.length ? ue.interface[m[1]](JSON.parse(t)) : ue.interface[m[1]](); }; })();" ) );
+
+		const bool bLast = Bulk.Offset + Length >= Bulk.Text.Len();
+		SendCall( "$bulk", FJsonLibraryValue( TArray<FJsonLibraryValue>{ Bulk.Id, Bulk.Function, Bulk.Text.Mid( Bulk.Offset, Length ), bLast } ) );
+
+		Bulk.Offset += Length;
+		Budget      -= Bytes;
+
+		if ( bLast )
+			BulkCalls.RemoveAt( 0 );
+	}
+
+	if ( BulkCalls.Num() > 0 || !BulkHandle.IsValid() )
+		return;
+
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+		IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().Remove( BulkHandle );
+
+	BulkHandle.Reset();
+#endif
+}
+
+FDelegateHandle UWebInterface::BindNativeEvent( FName Name, const FOnNativeInterfaceEvent::FDelegate& Delegate )
+{
+	TSharedRef<FEventHandlers>* Handlers = EventHandlers.Find( Name );
+	if ( !Handlers )
+		Handlers = &EventHandlers.Add( Name, MakeShared<FEventHandlers>() );
+
+	return ( *Handlers )->NativeEvents.Add( Delegate );
+}
+
+void UWebInterface::UnbindNativeEvent( FName Name, FDelegateHandle Handle )
+{
+	TSharedRef<FEventHandlers>* Handlers = EventHandlers.Find( Name );
+	if ( !Handlers )
+		return;
+
+	( *Handlers )->NativeEvents.Remove( Handle );
+	if ( ( *Handlers )->Events.Num() == 0 && !( *Handlers )->NativeEvents.IsBound() )
+		EventHandlers.Remove( Name );
+}
+
+UWebInterfaceStateStore* UWebInterface::GetStateStore( const FString& Name )
+{
+	if ( UWebInterfaceStateStore** Found = StateStores.Find( Name ) )
+		return *Found;
+
+	UWebInterfaceStateStore* Store = NewObject<UWebInterfaceStateStore>( this );
+	Store->Initialize( this, Name );
+
+	StateStores.Add( Name, Store );
+	return Store;
+}
+
+void UWebInterface::RemoveStateStore( const FString& Name )
+{
+	UWebInterfaceStateStore* Store = nullptr;
+	if ( !StateStores.RemoveAndCopyValue( Name, Store ) || !Store )
+		return;
+
+	// drop anything that was waiting to be sent
+	Store->MyInterface.Reset();
+	Store->Flush();
+
+	if ( bStateInstalled )
+		Call( "$state", FJsonLibraryValue( TArray<FJsonLibraryValue>{ Name, UJsonLibraryHelpers::ConstructNull(), int32( 0 ), true, false } ) );
+}
+
+void UWebInterface::InstallState()
+{
+	if ( bStateInstalled )
+		return;
+
+	Execute( UWebInterfaceStateStore::GetScript() );
+	bStateInstalled = true;
+}
+
+void UWebInterface::ReceiveState( const FJsonLibraryValue& Data )
+{
+	// [name, patch, version]
+	TArray<FJsonLibraryValue> Array = Data.ToArray();
+	if ( Array.Num() != 3 || Array[ 0 ].GetType() != EJsonLibraryType::String || Array[ 1 ].GetType() != EJsonLibraryType::Object )
+		return;
+
+	if ( UWebInterfaceStateStore** Found = StateStores.Find( Array[ 0 ].GetString() ) )
+		if ( *Found )
+			( *Found )->ReceivePatch( Array[ 1 ].GetObject(), Array[ 2 ].GetInteger() );
+}
+
 void UWebInterface::EnableIME()
 {
 #if !UE_SERVER
@@ -458,6 +1139,7 @@ void UWebInterface::ReleaseSlateResources( bool bReleaseChildren )
 {
 	Super::ReleaseSlateResources( bReleaseChildren );
 #if !UE_SERVER
+	Flush();
 	WebInterfaceWidget.Reset();
 #endif
 }
@@ -488,6 +1170,7 @@ TSharedRef<SWidget> UWebInterface::RebuildWidget()
 								VirtualPointerTransparencyThreshold :
 								MouseTransparencyThreshold )
 		.OnConsoleEvent( BIND_UOBJECT_DELEGATE( FOnConsoleLogDelegate, HandleConsole ) )
+		.OnLoadCompleted( BIND_UOBJECT_DELEGATE( FSimpleDelegate, HandleLoadCompleted ) )
 		.OnUrlChanged( BIND_UOBJECT_DELEGATE( FOnTextChanged, HandleUrlChanged ) )
 		.OnBeforePopup( BIND_UOBJECT_DELEGATE( FOnBeforePopupDelegate, HandleBeforePopup ) );
 
@@ -507,53 +1190,303 @@ TSharedRef<SWidget> UWebInterface::RebuildWidget()
 #endif
 }
 
+void UWebInterface::HandleLoadCompleted()
+{
+	InstallScripts();
+
+	// the page starts without ue.interface.$resolve, it is installed now so pages can pool callbacks right away
+	InstallResolver();
+
+	// calls that were partly sent start over
+	for ( FWebInterfaceBulkCall& Bulk : BulkCalls )
+		Bulk.Offset = 0;
+
+	// the page starts without ue.state
+	bStateInstalled = false;
+	for ( const TPair<FString, UWebInterfaceStateStore*>& Temp : StateStores )
+		if ( Temp.Value )
+			Temp.Value->ResetPage();
+}
+
 void UWebInterface::HandleUrlChanged( const FText& URL )
 {
-	FString Hash = URL.ToString();
+	FString Text = URL.ToString();
+	if ( !FWebInterfaceHashDecoder::IsMessage( Text ) )
+	{
+		OnUrlChangedEvent.Broadcast( URL );
+		return;
+	}
+
+	if ( !HashDecoder.IsValid() )
+		HashDecoder = MakeShared<FWebInterfaceHashDecoder, ESPMode::ThreadSafe>();
+
+#if !UE_SERVER
+	// broadcasts are decoded on a worker, and dispatched before the next browser update
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+	{
+		HashDecoder->Decode( MoveTemp( Text ) );
+
+		if ( !HashHandle.IsValid() )
+			HashHandle = IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().AddUObject( this, &UWebInterface::DispatchDecodedEvents );
+
+		return;
+	}
+#endif
+
+	HashDecoder->DecodeNow( MoveTemp( Text ) );
+	DispatchDecodedEvents();
+}
+
+void UWebInterface::DispatchDecodedEvents()
+{
+	FWebInterfaceDecodedEvent Event;
+	while ( HashDecoder->Dequeue( Event ) )
+	{
+		// not a broadcast after all
+		if ( !Event.URL.IsEmpty() )
+			OnUrlChangedEvent.Broadcast( FText::FromString( Event.URL ) );
+		else if ( !Event.Callback.IsEmpty() )
+			ReceiveEvent( Event.Name, Event.Data, FWebInterfaceCallback( this, Event.Callback ) );
+		else
+			ReceiveEvent( Event.Name, Event.Data, FWebInterfaceCallback() );
+	}
+
+#if !UE_SERVER
+	if ( !HashDecoder->IsIdle() || !HashHandle.IsValid() )
+		return;
+
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+		IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().Remove( HashHandle );
+
+	HashHandle.Reset();
+#endif
+}
+
+const FWebInterfaceEventPolicy* UWebInterface::FindEventPolicy( FName Name ) const
+{
+	const UWebInterfaceSettings* Settings = GetDefault<UWebInterfaceSettings>();
+
+	const FWebInterfaceEventPolicy* Policy = EventPolicies.Find( Name );
+	if ( !Policy )
+		Policy = Settings->EventPolicies.Find( Name );
+	if ( !Policy )
+		Policy = &Settings->DefaultEventPolicy;
+
+	// an empty policy can be used to exempt an event from the defaults
+	return Policy->IsActive() ? Policy : nullptr;
+}
+
+double UWebInterface::GetEventBudget() const
+{
+	if ( EventBudget > 0.0f )
+		return EventBudget / 1000.0;
+
+	return GetDefault<UWebInterfaceSettings>()->EventBudget / 1000.0;
+}
+
+bool UWebInterface::IsEventReady( FName Name, const FWebInterfaceEventPolicy* Policy, double Now ) const
+{
+	if ( !Policy || Policy->MaxRate <= 0.0f )
+		return true;
+
+	const double* Last = LastEvents.Find( Name );
+	return !Last || Now - *Last >= 1.0 / Policy->MaxRate;
+}
+
+void UWebInterface::ReceiveEvent( FName Name, const FJsonLibraryValue& Data, const FWebInterfaceCallback& Callback )
+{
+	// state patches are never limited or dropped
+	if ( Name == "$state" )
+	{
+		ReceiveState( Data );
+		return;
+	}
 
-	int32 Index = Hash.Find( "#" );
-	if ( Index >= 0 )
-		Hash = Hash.RightChop( Index + 1 );
+	const FWebInterfaceEventPolicy* Policy = FindEventPolicy( Name );
+	const double Budget = GetEventBudget();
 
-	if ( ( Hash.StartsWith( "[" ) && Hash.EndsWith( "]" ) ) || ( Hash.StartsWith( "%5B" ) && Hash.EndsWith( "%5D" ) ) )
+	// nothing to limit
+	if ( !Policy && Budget <= 0.0 )
 	{
-		FString JSON = FPlatformHttp::UrlDecode( Hash );
+		DispatchEvent( Name, Data, Callback );
+		return;
+	}
 
-		FJsonLibraryValue Value = FJsonLibraryValue::Parse( JSON );
-		if ( Value.GetType() == EJsonLibraryType::Array )
+	if ( EventFrame != GFrameCounter )
+	{
+		EventFrame = GFrameCounter;
+		EventTime  = 0.0;
+	}
+
+	// dispatch right away while there is time left, waiting events go first to keep the order
+	const double Now = FPlatformTime::Seconds();
+	if ( PendingEventCounts.Num() <= 0 && ( Budget <= 0.0 || EventTime < Budget ) && IsEventReady( Name, Policy, Now ) )
+	{
+		if ( Policy )
+			LastEvents.Add( Name, Now );
+
+		DispatchEvent( Name, Data, Callback );
+		EventTime += FPlatformTime::Seconds() - Now;
+		return;
+	}
+
+	QueueEvent( Name, Data, Callback, Policy );
+}
+
+void UWebInterface::QueueEvent( FName Name, const FJsonLibraryValue& Data, const FWebInterfaceCallback& Callback, const FWebInterfaceEventPolicy* Policy )
+{
+	if ( Policy && Policy->bCoalesce )
+	{
+		// latest wins, but the event keeps its place in the queue
+		if ( const int32* Index = PendingEventIndices.Find( Name ) )
 		{
-			TArray<FJsonLibraryValue> Array = Value.ToArray();
-			if ( Array.Num() == 2 || Array.Num() == 3 )
-			{
-				FJsonLibraryValue Name = Array[ 0 ];
-				FJsonLibraryValue Data = Array[ 1 ];
-				if ( Name.GetType() == EJsonLibraryType::String )
-				{
-					FName BroadcastName = *Name.GetString();
-					if ( Array.Num() > 2 )
-					{
-						FJsonLibraryValue Callback = Array[ 2 ];
-						if ( Callback.GetType() == EJsonLibraryType::String )
-						{
-							FString BroadcastCallback = Callback.GetString();
-							if ( !BroadcastCallback.IsEmpty() )
-							{
-								OnInterfaceEvent.Broadcast( BroadcastName, Data, FWebInterfaceCallback( this, BroadcastCallback ) );
-								return;
-							}
-						}
-					}
-					
-					OnInterfaceEvent.Broadcast( BroadcastName, Data, FWebInterfaceCallback() );
-					return;
-				}
-			}
-			
+			PendingEvents[ *Index ].Data     = Data;
+			PendingEvents[ *Index ].Callback = Callback;
 			return;
 		}
 	}
+	else
+	{
+		// anything waiting behind a rate limit or the budget is bounded, events without a limit of their own use the default
+		const int32 MaxQueued = Policy && Policy->MaxQueued > 0 ? Policy->MaxQueued : DefaultMaxQueuedEvents;
+		const int32* Count    = PendingEventCounts.Find( Name );
+
+		// drop the oldest
+		int32 Drop = Count ? *Count - MaxQueued + 1 : 0;
+		for ( int32 Index = 0; Index < PendingEvents.Num() && Drop > 0; Index++ )
+		{
+			if ( PendingEvents[ Index ].Name != Name )
+				continue;
+
+			RemovePendingEvent( Index );
+			Drop--;
+		}
+	}
+
+	PendingEventIndices.Add( Name, PendingEvents.Num() );
+	PendingEventCounts.FindOrAdd( Name )++;
+
+	PendingEvents.Add( FWebInterfacePendingEvent{ Name, Data, Callback } );
+
+#if !UE_SERVER
+	if ( EventsHandle.IsValid() )
+		return;
+
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+		EventsHandle = IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().AddUObject( this, &UWebInterface::DispatchPendingEvents );
+	else
+		DispatchPendingEvents();
+#endif
+}
+
+void UWebInterface::DispatchPendingEvents()
+{
+	// dispatched events can queue more, those are picked up by the loop below
+	if ( bDispatchingEvents )
+		return;
+
+	bDispatchingEvents = true;
+
+	EventFrame = GFrameCounter;
+	EventTime  = 0.0;
+
+	const double Budget = GetEventBudget();
+	const double Now    = FPlatformTime::Seconds();
+
+	int32 Dispatched = 0;
+	for ( int32 Index = 0; Index < PendingEvents.Num(); Index++ )
+	{
+		// always make some progress, even if a single event is over budget
+		if ( Budget > 0.0 && EventTime >= Budget && Dispatched > 0 )
+			break;
+
+		const FName Name = PendingEvents[ Index ].Name;
+		if ( Name.IsNone() )
+			continue;
+
+		// rate limited events wait, later events with the same name wait behind them
+		const FWebInterfaceEventPolicy* Policy = FindEventPolicy( Name );
+		if ( !IsEventReady( Name, Policy, Now ) )
+			continue;
+
+		FWebInterfacePendingEvent Event = MoveTemp( PendingEvents[ Index ] );
+		RemovePendingEvent( Index );
+
+		const double Start = FPlatformTime::Seconds();
+		if ( Policy )
+			LastEvents.Add( Name, Start );
+
+		DispatchEvent( Event.Name, Event.Data, Event.Callback );
+		EventTime += FPlatformTime::Seconds() - Start;
+		Dispatched++;
+	}
+
+	// compact once, the indices were kept up to date while dispatching
+	if ( PendingEvents.RemoveAll( []( const FWebInterfacePendingEvent& Event ) { return Event.Name.IsNone(); } ) > 0 )
+		IndexPendingEvents();
+
+	bDispatchingEvents = false;
+
+#if !UE_SERVER
+	if ( PendingEvents.Num() > 0 || !EventsHandle.IsValid() )
+		return;
+
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+		IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().Remove( EventsHandle );
+
+	EventsHandle.Reset();
+#endif
+}
+
+void UWebInterface::RemovePendingEvent( int32 Index )
+{
+	FWebInterfacePendingEvent& Event = PendingEvents[ Index ];
+
+	int32& Count = PendingEventCounts.FindChecked( Event.Name );
+	if ( --Count <= 0 )
+		PendingEventCounts.Remove( Event.Name );
+
+	const int32* Latest = PendingEventIndices.Find( Event.Name );
+	if ( Latest && *Latest == Index )
+		PendingEventIndices.Remove( Event.Name );
+
+	// the empty slot is removed when the queue is compacted
+	Event = FWebInterfacePendingEvent();
+}
+
+void UWebInterface::IndexPendingEvents()
+{
+	PendingEventIndices.Reset();
+	PendingEventCounts.Reset();
+
+	for ( int32 Index = 0; Index < PendingEvents.Num(); Index++ )
+	{
+		PendingEventIndices.Add( PendingEvents[ Index ].Name, Index );
+		PendingEventCounts.FindOrAdd( PendingEvents[ Index ].Name )++;
+	}
+}
+
+void UWebInterface::DispatchEvent( FName Name, const FJsonLibraryValue& Data, const FWebInterfaceCallback& Callback )
+{
+#if !UE_SERVER
+	if ( FWebInterfaceJSProfiler::IsEnabled() )
+		FWebInterfaceJSProfiler::AddEvent( Name, Data.Stringify().Len() );
+
+	WEBUI_BRIDGE_SCOPE( Event, Name );
+#endif
+
+	if ( const TSharedRef<FEventHandlers>* Found = EventHandlers.Find( Name ) )
+	{
+		// keep the handlers alive, and the events stable, if they are changed while being called
+		TSharedRef<FEventHandlers> Handlers = *Found;
+		TArray<FOnNamedInterfaceEvent> Events = Handlers->Events;
+
+		Handlers->NativeEvents.Broadcast( Data, Callback );
+		for ( const FOnNamedInterfaceEvent& Event : Events )
+			Event.ExecuteIfBound( Data, Callback );
+	}
 
-	OnUrlChangedEvent.Broadcast( URL );
+	OnInterfaceEvent.Broadcast( Name, Data, Callback );
 }
 
 bool UWebInterface::HandleBeforePopup( FString URL, FString Frame )
@@ -26,11 +26,5 @@ void FWebInterfaceCallback::Call( const FJsonLibraryValue& Data )
 	if ( !MyInterface.IsValid() || MyCallback.IsEmpty() )
 		return;
 
-	if ( Data.GetType() != EJsonLibraryType::Invalid )
-		MyInterface->Execute( FString::Printf( TEXT( "ue.interface[%s](%s)" ),
-			*FJsonLibraryValue( MyCallback ).Stringify(),
-			*Data.Stringify() ) );
-	else
-		MyInterface->Execute( FString::Printf( TEXT( "ue.interface[%s]()" ),
-			*FJsonLibraryValue( MyCallback ).Stringify() ) );
+	MyInterface->Resolve( MyCallback, Data );
 }
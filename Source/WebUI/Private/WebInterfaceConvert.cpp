@@ -0,0 +1,104 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "WebInterfaceConvert.h"
+
+#if !UE_SERVER
+FWebInterfaceJSParam FWebInterfaceConvert::ToScriptParam( const FJsonLibraryValue& Value )
+{
+	FWebInterfaceJSParam Param;
+	switch ( Value.GetType() )
+	{
+		case EJsonLibraryType::Boolean:
+			Param.Tag       = FWebInterfaceJSParam::PTYPE_BOOL;
+			Param.BoolValue = Value.GetBoolean();
+			break;
+		case EJsonLibraryType::Number:
+			Param.Tag         = FWebInterfaceJSParam::PTYPE_DOUBLE;
+			Param.DoubleValue = Value.GetNumber();
+			break;
+		case EJsonLibraryType::String:
+			Param.Tag         = FWebInterfaceJSParam::PTYPE_STRING;
+			Param.StringValue = new FString( Value.GetString() );
+			break;
+		case EJsonLibraryType::Array:
+		{
+			TArray<FJsonLibraryValue> Array = Value.ToArray();
+
+			Param.Tag        = FWebInterfaceJSParam::PTYPE_ARRAY;
+			Param.ArrayValue = new TArray<FWebInterfaceJSParam>();
+			Param.ArrayValue->Reserve( Array.Num() );
+
+			for ( const FJsonLibraryValue& Item : Array )
+				Param.ArrayValue->Add( ToScriptParam( Item ) );
+			break;
+		}
+		case EJsonLibraryType::Object:
+		{
+			TMap<FString, FJsonLibraryValue> Map = Value.ToMap();
+
+			Param.Tag      = FWebInterfaceJSParam::PTYPE_MAP;
+			Param.MapValue = new TMap<FString, FWebInterfaceJSParam>();
+			Param.MapValue->Reserve( Map.Num() );
+
+			for ( const TPair<FString, FJsonLibraryValue>& Temp : Map )
+				Param.MapValue->Add( Temp.Key, ToScriptParam( Temp.Value ) );
+			break;
+		}
+		default:
+			break;
+	}
+
+	return Param;
+}
+
+FJsonLibraryValue FWebInterfaceConvert::FromScriptParam( const FWebInterfaceJSParam& Param )
+{
+	switch ( Param.Tag )
+	{
+		case FWebInterfaceJSParam::PTYPE_BOOL:
+			return FJsonLibraryValue( Param.BoolValue );
+		case FWebInterfaceJSParam::PTYPE_INT:
+			return FJsonLibraryValue( Param.IntValue );
+		case FWebInterfaceJSParam::PTYPE_DOUBLE:
+			return FJsonLibraryValue( Param.DoubleValue );
+		case FWebInterfaceJSParam::PTYPE_STRING:
+			return FJsonLibraryValue( *Param.StringValue );
+		case FWebInterfaceJSParam::PTYPE_STRUCT:
+			return FJsonLibraryValue( FJsonLibraryObject( MakeShared<FStructOnScope>( Param.StructValue->GetTypeInfo(), (uint8*)Param.StructValue->GetData() ) ) );
+		case FWebInterfaceJSParam::PTYPE_ARRAY:
+		{
+			TArray<FJsonLibraryValue> Array;
+			Array.Reserve( Param.ArrayValue->Num() );
+
+			for ( const FWebInterfaceJSParam& Item : *Param.ArrayValue )
+				Array.Add( FromScriptParam( Item ) );
+
+			return FJsonLibraryValue( Array );
+		}
+		case FWebInterfaceJSParam::PTYPE_MAP:
+		{
+			TMap<FString, FJsonLibraryValue> Map;
+			Map.Reserve( Param.MapValue->Num() );
+
+			for ( const TPair<FString, FWebInterfaceJSParam>& Temp : *Param.MapValue )
+				Map.Add( Temp.Key, FromScriptParam( Temp.Value ) );
+
+			return FJsonLibraryValue( Map );
+		}
+		case FWebInterfaceJSParam::PTYPE_TYPED_ARRAY:
+		{
+			TArray<FJsonLibraryValue> Array;
+			Array.Reserve( Param.TypedArrayValue->Num() );
+
+			for ( int32 Index = 0; Index < Param.TypedArrayValue->Num(); Index++ )
+				Array.Add( FJsonLibraryValue( Param.TypedArrayValue->GetValue( Index ) ) );
+
+			return FJsonLibraryValue( Array );
+		}
+		default:
+			break;
+	}
+
+	// objects don't have a JSON representation
+	return FJsonLibraryValue();
+}
+#endif
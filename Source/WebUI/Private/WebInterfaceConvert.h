@@ -0,0 +1,22 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "JsonLibrary.h"
+
+#ifndef UE_SERVER
+#define UE_SERVER 0
+#endif
+
+#if !UE_SERVER
+#include "WebInterfaceJSFunction.h"
+
+// Converts between JSON values and native script values, so data doesn't need to be stringified and parsed.
+class FWebInterfaceConvert
+{
+public:
+
+	// Convert a JSON value to a script value.
+	static FWebInterfaceJSParam ToScriptParam( const FJsonLibraryValue& Value );
+	// Convert a script value to a JSON value.
+	static FJsonLibraryValue FromScriptParam( const FWebInterfaceJSParam& Param );
+};
+#endif
@@ -0,0 +1,14 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "WebInterfaceEventPolicy.h"
+
+FWebInterfaceEventPolicy::FWebInterfaceEventPolicy()
+{
+	MaxRate   = 0.0f;
+	bCoalesce = false;
+	MaxQueued = 0;
+}
+
+bool FWebInterfaceEventPolicy::IsActive() const
+{
+	return MaxRate > 0.0f || bCoalesce || MaxQueued > 0;
+}
@@ -0,0 +1,136 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "WebInterfaceHashDecoder.h"
+#include "PlatformHttp.h"
+#include "Async/Async.h"
+
+bool FWebInterfaceHashDecoder::IsMessage( const FString& URL )
+{
+	return URL.EndsWith( "]" ) || URL.EndsWith( "%5D" );
+}
+
+void FWebInterfaceHashDecoder::Decode( FString URL )
+{
+	Input.Enqueue( MoveTemp( URL ) );
+
+	// a single worker at a time keeps the order
+	if ( bWorking.exchange( true ) )
+		return;
+
+	TSharedRef<FWebInterfaceHashDecoder, ESPMode::ThreadSafe> Decoder = AsShared();
+	AsyncTask( ENamedThreads::AnyBackgroundThreadNormalTask, [ Decoder ]()
+	{
+		Decoder->DecodeQueued();
+	} );
+}
+
+void FWebInterfaceHashDecoder::DecodeNow( FString URL )
+{
+	Input.Enqueue( MoveTemp( URL ) );
+
+	// a worker that is still running picks it up instead, to keep the order
+	if ( !bWorking.exchange( true ) )
+		DecodeQueued();
+}
+
+bool FWebInterfaceHashDecoder::Dequeue( FWebInterfaceDecodedEvent& Event )
+{
+	return Output.Dequeue( Event );
+}
+
+bool FWebInterfaceHashDecoder::IsIdle() const
+{
+	return !bWorking && Input.IsEmpty() && Output.IsEmpty();
+}
+
+void FWebInterfaceHashDecoder::DecodeQueued()
+{
+	do
+	{
+		FString URL;
+		while ( Input.Dequeue( URL ) )
+		{
+			if ( DecodeHash( URL ) )
+				continue;
+
+			FWebInterfaceDecodedEvent Event;
+			Event.URL = MoveTemp( URL );
+			Output.Enqueue( MoveTemp( Event ) );
+		}
+
+		bWorking = false;
+	}
+	// something may have been queued after the last dequeue, keep going unless another worker took it
+	while ( !Input.IsEmpty() && !bWorking.exchange( true ) );
+}
+
+bool FWebInterfaceHashDecoder::DecodeHash( const FString& URL )
+{
+	FString Hash = URL;
+
+	int32 Index = Hash.Find( "#" );
+	if ( Index >= 0 )
+		Hash = Hash.RightChop( Index + 1 );
+
+	if ( ( Hash.StartsWith( "[" ) && Hash.EndsWith( "]" ) ) || ( Hash.StartsWith( "%5B" ) && Hash.EndsWith( "%5D" ) ) )
+		return DecodeMessage( FPlatformHttp::UrlDecode( Hash ), true );
+
+	return false;
+}
+
+bool FWebInterfaceHashDecoder::DecodeMessage( const FString& JSON, bool bParts )
+{
+	FJsonLibraryValue Value = FJsonLibraryValue::Parse( JSON );
+	if ( Value.GetType() != EJsonLibraryType::Array )
+		return false;
+
+	TArray<FJsonLibraryValue> Array = Value.ToArray();
+
+	// ["$part", id, index, count, text]
+	if ( bParts && Array.Num() == 5 && Array[ 0 ].GetType() == EJsonLibraryType::String && Array[ 0 ].GetString() == "$part" )
+	{
+		const FString Id    = Array[ 1 ].GetString();
+		const int32   Part  = Array[ 2 ].GetInteger();
+		const int32   Count = Array[ 3 ].GetInteger();
+		if ( Count <= 0 || Count > 4096 || Part < 0 || Part >= Count )
+			return true;
+
+		// pages that reload can leave messages unfinished
+		if ( !Parts.Contains( Id ) && Parts.Num() >= 64 )
+			Parts.Reset();
+
+		TArray<FString>& Texts = Parts.FindOrAdd( Id );
+		if ( Texts.Num() != Count )
+		{
+			Texts.Reset();
+			Texts.SetNum( Count );
+		}
+
+		Texts[ Part ] = Array[ 4 ].GetString();
+		for ( const FString& Text : Texts )
+			if ( Text.IsEmpty() )
+				return true;
+
+		const FString Message = FString::Join( Texts, TEXT( "" ) );
+		Parts.Remove( Id );
+
+		DecodeMessage( Message, false );
+		return true;
+	}
+
+	if ( ( Array.Num() != 2 && Array.Num() != 3 ) || Array[ 0 ].GetType() != EJsonLibraryType::String )
+		return true;
+
+	FWebInterfaceDecodedEvent Event;
+	Event.Name = *Array[ 0 ].GetString();
+	Event.Data = MoveTemp( Array[ 1 ] );
+
+	if ( Array.Num() > 2 && Array[ 2 ].GetType() == EJsonLibraryType::String )
+		Event.Callback = Array[ 2 ].GetString();
+
+	// the data must only be referenced by the event once it is handed over, shared pointers aren't thread safe
+	Array.Empty();
+	Value = FJsonLibraryValue();
+
+	Output.Enqueue( MoveTemp( Event ) );
+	return true;
+}
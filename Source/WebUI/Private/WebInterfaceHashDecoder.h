@@ -0,0 +1,47 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "JsonLibrary.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+// A broadcast from the page, decoded from the URL hash.
+struct FWebInterfaceDecodedEvent
+{
+	FName Name;
+	FJsonLibraryValue Data;
+	FString Callback;
+	// set instead when the URL turned out not to be a broadcast
+	FString URL;
+};
+
+// Decodes broadcasts sent through the URL hash on a worker, one hash at a time and in the order they were changed.
+// Messages too long for a URL can be sent as ["$part", id, index, count, text], the text of the parts is joined and decoded once all have arrived.
+class FWebInterfaceHashDecoder : public TSharedFromThis<FWebInterfaceHashDecoder, ESPMode::ThreadSafe>
+{
+public:
+
+	// Check if a URL may hold a broadcast, without looking at more than its end.
+	static bool IsMessage( const FString& URL );
+
+	// Queue a URL for decoding, called on the game thread.
+	void Decode( FString URL );
+	// Decode a URL on the calling thread, when there is no update to dispatch decoded events from.
+	void DecodeNow( FString URL );
+	// Get the next decoded event, called on the game thread.
+	bool Dequeue( FWebInterfaceDecodedEvent& Event );
+	// Check if there is nothing left to decode or dequeue.
+	bool IsIdle() const;
+
+private:
+
+	TQueue<FString, EQueueMode::Spsc> Input;
+	TQueue<FWebInterfaceDecodedEvent, EQueueMode::Spsc> Output;
+	std::atomic<bool> bWorking { false };
+
+	// parts of long messages, only used by the worker
+	TMap<FString, TArray<FString>> Parts;
+
+	void DecodeQueued();
+	bool DecodeHash( const FString& URL );
+	bool DecodeMessage( const FString& JSON, bool bParts );
+};
@@ -9,7 +9,18 @@ void UWebInterfaceObject::Broadcast( const FString& Name, const FString& Data, c
 		return;
 
 	if ( Callback.IsEmpty() )
-		MyInterface->OnInterfaceEvent.Broadcast( FName( *Name ), FJsonLibraryValue::Parse( Data ), FWebInterfaceCallback() );
+		MyInterface->ReceiveEvent( FName( *Name ), FJsonLibraryValue::Parse( Data ), FWebInterfaceCallback() );
 	else
-		MyInterface->OnInterfaceEvent.Broadcast( FName( *Name ), FJsonLibraryValue::Parse( Data ), FWebInterfaceCallback( MyInterface, Callback ) );
+		MyInterface->ReceiveEvent( FName( *Name ), FJsonLibraryValue::Parse( Data ), FWebInterfaceCallback( MyInterface, Callback ) );
+}
+
+void UWebInterfaceObject::BroadcastData( const FString& Name, const FJsonLibraryValue& Data, const FString& Callback )
+{
+	if ( !MyInterface.IsValid() )
+		return;
+
+	if ( Callback.IsEmpty() )
+		MyInterface->ReceiveEvent( FName( *Name ), Data, FWebInterfaceCallback() );
+	else
+		MyInterface->ReceiveEvent( FName( *Name ), Data, FWebInterfaceCallback( MyInterface, Callback ) );
 }
@@ -0,0 +1,233 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#include "WebInterfaceStateStore.h"
+#include "WebInterface.h"
+
+#if !UE_SERVER
+#include "WebInterfaceBrowserModule.h"
+#include "IWebInterfaceBrowserSingleton.h"
+#endif
+
+UWebInterfaceStateStore::UWebInterfaceStateStore()
+{
+	Sync     = EWebInterfaceStateSync::OneWay;
+	Conflict = EWebInterfaceStateConflict::EngineWins;
+
+	Version    = 0;
+	bDirty     = false;
+	bAllDirty  = false;
+	bSynced    = false;
+	bReceiving = false;
+}
+
+FJsonLibraryObject UWebInterfaceStateStore::GetState() const
+{
+	return State;
+}
+
+FString UWebInterfaceStateStore::GetName() const
+{
+	return MyName;
+}
+
+void UWebInterfaceStateStore::MarkDirty()
+{
+	bAllDirty = true;
+	ScheduleFlush();
+}
+
+void UWebInterfaceStateStore::Flush()
+{
+#if !UE_SERVER
+	if ( FlushHandle.IsValid() )
+	{
+		if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+			IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().Remove( FlushHandle );
+
+		FlushHandle.Reset();
+	}
+#endif
+
+	if ( !bDirty )
+		return;
+
+	UWebInterface* Interface = MyInterface.Get();
+	if ( !Interface )
+		return;
+
+	const TSet<FString> Keys = MoveTemp( DirtyKeys );
+	const bool bAll = bAllDirty;
+
+	bDirty = false;
+	DirtyKeys.Reset();
+	bAllDirty = false;
+
+	// the page has nothing yet, send all of it
+	if ( !bSynced )
+	{
+		Mirror = FJsonLibraryObject();
+		Mirror.MergePatch( State );
+
+		Version++;
+		for ( const FString& Key : Mirror.GetKeys() )
+			KeyVersions.Add( Key, Version );
+
+		Interface->InstallState();
+		Interface->Call( "$state", FJsonLibraryValue( TArray<FJsonLibraryValue>{ MyName, Mirror, Version, true, Sync == EWebInterfaceStateSync::TwoWay } ) );
+
+		bSynced = true;
+		return;
+	}
+
+	// only what changed since the last flush, the whole state is compared when changes weren't tracked by property
+	FJsonLibraryObject Patch;
+	if ( bAll )
+		Patch = Mirror.CreateMergePatch( State );
+	else
+	{
+		FJsonLibraryObject Sent;
+		FJsonLibraryObject Changed;
+		for ( const FString& Key : Keys )
+		{
+			if ( Mirror.HasKey( Key ) )
+				Sent.SetValue( Key, Mirror.GetValue( Key ) );
+			if ( State.HasKey( Key ) )
+				Changed.SetValue( Key, State.GetValue( Key ) );
+		}
+
+		Patch = Sent.CreateMergePatch( Changed );
+	}
+
+	if ( Patch.Count() <= 0 )
+		return;
+
+	Mirror.MergePatch( Patch );
+
+	Version++;
+	for ( const FString& Key : Patch.GetKeys() )
+		KeyVersions.Add( Key, Version );
+
+	Interface->Call( "$state", FJsonLibraryValue( TArray<FJsonLibraryValue>{ MyName, Patch, Version, false, Sync == EWebInterfaceStateSync::TwoWay } ) );
+}
+
+FString UWebInterfaceStateStore::GetScript()
+{
+	// ue.state[name] holds the data, ue.state.$on(name, path, fn) listens for changes below a path and returns a function to stop
+	// listeners are called with (value, previous, path, remote), ue.state.$patch(name, patch) changes two way states from the page
+	return TEXT( "typeof ue != 'undefined' && typeof ue.interface != 'undefined' && typeof ue.interface['$state'] != 'function' && (function(){ " )
+		TEXT( "var s = ue.state = ue.state || {}, l = [], v = {}, w = {}; " )
+		TEXT( "var a = function(t, d, q, c){ for (var k in d){ var o = t[k], n = d[k], x = q ? q + '.' + k : k; " )
+		TEXT( "if (n === null){ if (k in t){ delete t[k]; c.push([x, undefined, o]); } } " )
+		TEXT( "else if (typeof n == 'object' && !Array.isArray(n)){ if (o === null || typeof o != 'object' || Array.isArray(o)){ t[k] = {}; c.push([x, t[k], o]); } a(t[k], n, x, c); } " )
+		TEXT( "else { t[k] = n; c.push([x, n, o]); } } }; " )
+		TEXT( "var e = function(n, c, r){ l.slice().forEach(function(h){ if (h[0] == n) c.forEach(function(x){ " )
+		TEXT( "if (!h[1] || !x[0] || x[0] == h[1] || x[0].indexOf(h[1] + '.') == 0 || h[1].indexOf(x[0] + '.') == 0) h[2](x[1], x[2], x[0], r); }); }); }; " )
+		TEXT( "s['$on'] = function(n, p, f){ var h = [n, p || '', f]; l.push(h); return function(){ var i = l.indexOf(h); if (i >= 0) l.splice(i, 1); }; }; " )
+		TEXT( "s['$patch'] = function(n, d){ if (!w[n]) return false; var c = []; a(s[n], d, '', c); e(n, c, false); var m = [n, d, v[n]]; " )
+		TEXT( "typeof ue.interface.broadcastdata == 'function' ? ue.interface.broadcastdata('$state', m, '') : ue.interface.broadcast('$state', JSON.stringify(m), ''); return true; }; " )
+		TEXT( "ue.interface['$state'] = function(m){ var n = m[0], o = s[n]; v[n] = m[2]; w[n] = !!m[4]; " )
+		TEXT( "if (m[3]){ if (m[1] === null) delete s[n]; else s[n] = m[1]; e(n, [['', s[n], o]], true); } " )
+		TEXT( "else { var c = []; a(s[n] = s[n] || {}, m[1], '', c); e(n, c, true); } }; " )
+		TEXT( "})();" );
+}
+
+void UWebInterfaceStateStore::Initialize( UWebInterface* Interface, const FString& Name )
+{
+	MyName      = Name;
+	MyInterface = Interface;
+
+	FJsonLibraryObjectNotify Notify;
+	Notify.BindUFunction( this, GET_FUNCTION_NAME_CHECKED( UWebInterfaceStateStore, HandleNotify ) );
+
+	State = FJsonLibraryObject( Notify );
+	ResetPage();
+}
+
+void UWebInterfaceStateStore::ResetPage()
+{
+	// the next flush sends everything again
+	bSynced = false;
+	ScheduleFlush();
+}
+
+void UWebInterfaceStateStore::ScheduleFlush()
+{
+	bDirty = true;
+
+#if !UE_SERVER
+	if ( FlushHandle.IsValid() )
+		return;
+
+	if ( IWebInterfaceBrowserModule::IsAvailable() && IWebInterfaceBrowserModule::Get().IsWebModuleAvailable() )
+		FlushHandle = IWebInterfaceBrowserModule::Get().GetSingleton()->OnPreTick().AddUObject( this, &UWebInterfaceStateStore::Flush );
+	else
+		Flush();
+#endif
+}
+
+void UWebInterfaceStateStore::ReceivePatch( const FJsonLibraryObject& Patch, int32 BaseVersion )
+{
+	// the page has already applied its patch
+	Mirror.MergePatch( Patch );
+
+	// a full state is on its way, or the page isn't allowed to change it
+	// either way the next flush sends the page back to what the state holds
+	if ( !bSynced || Sync != EWebInterfaceStateSync::TwoWay )
+	{
+		DirtyKeys.Append( Patch.GetKeys() );
+		ScheduleFlush();
+		return;
+	}
+
+	FJsonLibraryObject Accepted;
+	TArray<FString> Stale;
+	TArray<FString> Rejected;
+
+	for ( const FString& Key : Patch.GetKeys() )
+	{
+		// the page hadn't seen our latest change to this property
+		const bool bStale = KeyVersions.FindRef( Key ) > BaseVersion;
+		if ( bStale )
+			Stale.Add( Key );
+
+		if ( Conflict == EWebInterfaceStateConflict::EngineWins && ( bStale || bAllDirty || DirtyKeys.Contains( Key ) ) )
+		{
+			Rejected.Add( Key );
+			continue;
+		}
+
+		Accepted.SetValue( Key, Patch.GetValue( Key ) );
+	}
+
+	bReceiving = true;
+	State.MergePatch( Accepted );
+	bReceiving = false;
+
+	// our change reaches the page after its own, so send the property again
+	for ( const FString& Key : Stale )
+		Mirror.RemoveKey( Key );
+
+	// the page is sent back what the state holds for properties it wasn't allowed to change
+	DirtyKeys.Append( Stale );
+	DirtyKeys.Append( Rejected );
+
+	if ( Stale.Num() > 0 || Rejected.Num() > 0 )
+		ScheduleFlush();
+}
+
+void UWebInterfaceStateStore::HandleNotify( const FJsonLibraryValue& Object, EJsonLibraryNotifyAction Action, const FString& Key, const FJsonLibraryValue& Value )
+{
+	if ( Action == EJsonLibraryNotifyAction::None )
+		return;
+
+	if ( !bReceiving )
+	{
+		if ( Action == EJsonLibraryNotifyAction::Reset )
+			bAllDirty = true;
+		else
+			DirtyKeys.Add( Key );
+
+		ScheduleFlush();
+	}
+
+	OnStateChanged.Broadcast( Key, Value, bReceiving );
+}
@@ -17,6 +17,7 @@
 #include "Materials/Material.h"
 #include "IWebInterfaceBrowserSingleton.h"
 #include "WebInterfaceBrowserModule.h"
+#include "WebInterfaceConvert.h"
 #endif
 
 #define LOCTEXT_NAMESPACE "FWebUIModule"
@@ -49,6 +50,12 @@ public:
 #endif
 #endif
 		}
+
+		// read structured broadcast data straight into JSON values
+		FWebInterfaceJSStructReader::Register(FJsonLibraryValue::StaticStruct(), [](const FWebInterfaceJSParam& Value, void* StructPtr)
+		{
+			*(FJsonLibraryValue*)StructPtr = FWebInterfaceConvert::FromScriptParam(Value);
+		});
 #endif
 
 #if WITH_EDITOR
@@ -71,6 +78,10 @@ public:
 
 	virtual void ShutdownModule() override
 	{
+#if !UE_SERVER
+		FWebInterfaceJSStructReader::Unregister(FJsonLibraryValue::StaticStruct());
+#endif
+
 #if WITH_EDITOR
 		ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings");
 		if (SettingsModule)
@@ -26,6 +26,7 @@ class IWebInterfaceBrowserWindow;
 class IWebInterfaceBrowserPopupFeatures;
 enum class EWebInterfaceBrowserDialogEventResponse;
 struct FWebNavigationRequest;
+struct FWebInterfaceJSParam;
 
 class WEBUI_API SWebInterface : public SCompoundWidget
 {
@@ -204,6 +205,16 @@ public:
 	bool IsLoading() const;
 
 	void ExecuteJavascript( const FString& ScriptText );
+	bool CallJavascriptFunction( const FString& Function, const FWebInterfaceJSParam* Data );
+	bool CallJavascriptBatch( const FWebInterfaceJSParam& Calls );
+
+	void ObserveUObject( const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame = true );
+	void UnobserveUObject( const FString& Name, UObject* Object = nullptr );
+	void MarkUObjectDirty( UObject* Object );
+	void SetUObjectAsyncMethods( UObject* Object, const TArray<FName>& Methods );
+	void SetUObjectMemoized( UObject* Object, bool bMemoize );
+	void SetUObjectTypedArrays( UObject* Object, bool bTypedArrays );
+	void InvalidateUObject( UObject* Object );
 
 	void BindUObject( const FString& Name, UObject* Object, bool bIsPermanent = true );
 	void UnbindUObject( const FString& Name, UObject* Object, bool bIsPermanent = true );
@@ -4,6 +4,8 @@
 #include "Engine/EngineBaseTypes.h"
 #include "JsonLibrary.h"
 #include "WebInterfaceCallback.h"
+#include "WebInterfaceEventPolicy.h"
+#include "WebInterfaceStateStore.h"
 #include "WebInterface.generated.h"
 
 #ifndef UE_SERVER
@@ -17,9 +19,54 @@ enum class EWebInterfaceDirectory : uint8
 	Content	UMETA(DisplayName="/Content")
 };
 
+UENUM(BlueprintType, meta = (DisplayName = "UI Call Priority"))
+enum class EWebInterfacePriority : uint8
+{
+	Normal	UMETA(DisplayName="Normal"),
+	High	UMETA(DisplayName="High"),
+	Bulk	UMETA(DisplayName="Bulk")
+};
+
+// A call or script waiting to be sent at the end of the frame.
+struct FWebInterfaceQueuedCall
+{
+	FString Function;
+	FJsonLibraryValue Data;
+	bool bScript;
+};
+
+// A large call sent to the page in slices, a few each frame.
+struct FWebInterfaceBulkCall
+{
+	int32 Id;
+	FString Function;
+	FString Text;
+	// how much of the text has been sent
+	int32 Offset;
+};
+
+// A function installed on every page, called by handle.
+struct FWebInterfaceScript
+{
+	FString Name;
+	FString Source;
+};
+
+// An event from the browser waiting to be dispatched.
+struct FWebInterfacePendingEvent
+{
+	FName Name;
+	FJsonLibraryValue Data;
+	FWebInterfaceCallback Callback;
+};
+
 UCLASS()
 class WEBUI_API UWebInterface : public UWidget
 {
+	friend class UWebInterfaceObject;
+	friend class UWebInterfaceStateStore;
+	friend struct FWebInterfaceCallback;
+
 	GENERATED_UCLASS_BODY()
 
 public:
@@ -28,6 +75,8 @@ public:
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FOnPopupEvent, const FString&, URL, const FString&, Frame );
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams( FOnInterfaceEvent, const FName, Name, FJsonLibraryValue, Data, FWebInterfaceCallback, Callback );
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FOnConsoleEvent, const FString&, Text, FColor, Color );
+	DECLARE_DYNAMIC_DELEGATE_TwoParams( FOnNamedInterfaceEvent, FJsonLibraryValue, Data, FWebInterfaceCallback, Callback );
+	DECLARE_MULTICAST_DELEGATE_TwoParams( FOnNativeInterfaceEvent, const FJsonLibraryValue&, const FWebInterfaceCallback& );
 
 	// Load the browser.
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
@@ -53,8 +102,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
 	void Execute( const FString& Script );
 	// Call ue.interface.function(data) in the browser context.
-	UFUNCTION(BlueprintCallable, Category = "Web UI", meta = (AdvancedDisplay = "Data", AutoCreateRefTerm = "Data"))
-	void Call( const FString& Function, const FJsonLibraryValue& Data );
+	// When batching, a coalesced call replaces the data of a pending call to the same function.
+	// High priority calls are sent right away, ahead of batched and bulk calls. Bulk calls are sent in slices over
+	// as many frames as the bulk budget needs, so they arrive after normal calls made later.
+	UFUNCTION(BlueprintCallable, Category = "Web UI", meta = (AdvancedDisplay = "Data,bCoalesce,Priority", AutoCreateRefTerm = "Data"))
+	void Call( const FString& Function, const FJsonLibraryValue& Data, bool bCoalesce = false, EWebInterfacePriority Priority = EWebInterfacePriority::Normal );
+	// Call ue.interface.function(data) with a Float32Array, Int32Array or Uint8Array, vectors are sent as a Float32Array of x, y, z.
+	// Typed array calls are sent right away, after any calls that were queued.
+	void CallTypedArray( const FString& Function, const TArray<float>& Data );
+	void CallTypedArray( const FString& Function, const TArray<int32>& Data );
+	void CallTypedArray( const FString& Function, const TArray<uint8>& Data );
+	void CallTypedArray( const FString& Function, const TArray<FVector>& Data );
+	// Set the kilobytes per frame that may be sent for bulk calls, zero uses the project settings.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void SetBulkBudget( int32 Kilobytes );
+
+	// Queue calls and scripts during the frame, and send them together before the next browser update.
+	// Data is copied when it is queued, later changes to it are not sent.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void SetBatching( bool bEnable );
+	// Check if calls are batched until the end of the frame.
+	UFUNCTION(BlueprintPure, Category = "Web UI")
+	bool IsBatching() const;
+	// Register a script that is installed as a function on every page, the source is its body and receives data.
+	// Returns a handle for calling it, registering the same name again replaces the script and keeps the handle.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Scripts")
+	int32 RegisterScript( const FString& Name, const FString& Source );
+	// Find the handle of a registered script, or -1 if it isn't registered.
+	UFUNCTION(BlueprintPure, Category = "Web UI|Scripts")
+	int32 FindScript( const FString& Name ) const;
+	// Call a registered script, sending only its handle and the data.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Scripts", meta = (AdvancedDisplay = "Data", AutoCreateRefTerm = "Data"))
+	void InvokeScript( int32 Handle, const FJsonLibraryValue& Data );
+
+	// Send any calls that were queued this frame.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void Flush();
 	
 	// Bind an object to ue.name in the browser context.
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
@@ -62,7 +145,62 @@ public:
 	// Unbind an object from ue.name in the browser context.
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
 	void Unbind( const FString& Name, UObject* Object );
+
+	// Set blueprint visible properties of an object bound to ue.name in the browser context, and keep them updated.
+	// Only changed values are sent, watch them with ue.$watch(name, property, fn). All properties are sent if none are given.
+	UFUNCTION(BlueprintCallable, Category = "Web UI", meta = (AdvancedDisplay = "bEveryFrame", AutoCreateRefTerm = "Properties"))
+	void Observe( const FString& Name, UObject* Object, const TArray<FName>& Properties, bool bEveryFrame = true );
+	// Stop updating the properties of an object bound to ue.name in the browser context.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void Unobserve( const FString& Name, UObject* Object );
+	// Send changes to the observed properties of an object at the end of the frame.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void MarkDirty( UObject* Object );
+	// Run these methods of a bound object on a worker thread when the page calls them, none if empty.
+	// Only native functions marked BlueprintThreadSafe that don't touch game state, like read only queries.
+	// Garbage collection waits for these methods, so slow ones stall the game thread when a collection starts.
+	UFUNCTION(BlueprintCallable, Category = "Web UI", meta = (AutoCreateRefTerm = "Methods"))
+	void SetAsync( UObject* Object, const TArray<FName>& Methods );
+	// Reuse results of pure functions of a bound object called with the same arguments during a frame.
+	// Results are dropped every frame, and whenever the page calls a function of the object that isn't pure.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void SetMemoized( UObject* Object, bool bMemoize );
+	// Send float, integer, byte and vector arrays returned by functions of a bound object as typed arrays.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void SetTypedArrays( UObject* Object, bool bTypedArrays );
+	// Drop the results kept for a bound object, after changing what its pure functions return.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void InvalidateBinding( UObject* Object );
+
+	// Bind an event that is only called for ue.interface.broadcast(name, data) with a matching name.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Events")
+	void BindEvent( FName Name, FOnNamedInterfaceEvent Event );
+	// Unbind an event that was bound with a name.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Events")
+	void UnbindEvent( FName Name, FOnNamedInterfaceEvent Event );
+
+	// Set the policy for an event, overriding the project settings.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Events")
+	void SetEventPolicy( FName Name, const FWebInterfaceEventPolicy& Policy );
+	// Remove the policy for an event, so the project settings are used.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Events")
+	void ClearEventPolicy( FName Name );
+	// Set the milliseconds per frame that may be spent dispatching events, zero uses the project settings.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|Events")
+	void SetEventBudget( float Milliseconds );
+
+	// Bind a native handler that is only called for broadcasts with a matching name.
+	FDelegateHandle BindNativeEvent( FName Name, const FOnNativeInterfaceEvent::FDelegate& Delegate );
+	// Unbind a native handler that was bound with a name.
+	void UnbindNativeEvent( FName Name, FDelegateHandle Handle );
 	
+	// Get the state mirrored to ue.state[Name] on the page, it is created if needed.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|State")
+	UWebInterfaceStateStore* GetStateStore( const FString& Name );
+	// Stop mirroring a state and remove it from the page.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|State")
+	void RemoveStateStore( const FString& Name );
+
 	// Enables input method editors for different languages.
 	UFUNCTION(BlueprintCallable, Category = "Web UI|Input")
 	void EnableIME();
@@ -128,7 +266,8 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Web UI|Events")
 	FOnPopupEvent OnPopupEvent;
 	
-	// Called with ue.interface.broadcast(name, data) in the browser context.
+	// Called with ue.interface.broadcast(name, data) or ue.interface.broadcastdata(name, data) in the browser context.
+	// Events bound by name are called first, and only for their name.
 	UPROPERTY(BlueprintAssignable, Category = "Web UI|Events")
 	FOnInterfaceEvent OnInterfaceEvent;
 	UPROPERTY(BlueprintAssignable, Category = "Web UI|Events")
@@ -145,6 +284,76 @@ private:
 	UPROPERTY()
 	class UWebInterfaceObject* MyObject;
 
+	struct FEventHandlers
+	{
+		TArray<FOnNamedInterfaceEvent> Events;
+		FOnNativeInterfaceEvent NativeEvents;
+	};
+
+	TMap<FName, TSharedRef<FEventHandlers>> EventHandlers;
+
+	TArray<FWebInterfacePendingEvent> PendingEvents;
+	// the latest waiting event and the number waiting, by name
+	TMap<FName, int32> PendingEventIndices;
+	TMap<FName, int32> PendingEventCounts;
+	TMap<FName, double> LastEvents;
+	FDelegateHandle EventsHandle;
+	uint64 EventFrame;
+	double EventTime;
+	bool bDispatchingEvents;
+
+	const FWebInterfaceEventPolicy* FindEventPolicy( FName Name ) const;
+	double GetEventBudget() const;
+	bool IsEventReady( FName Name, const FWebInterfaceEventPolicy* Policy, double Now ) const;
+
+	void ReceiveEvent( FName Name, const FJsonLibraryValue& Data, const FWebInterfaceCallback& Callback );
+	void QueueEvent( FName Name, const FJsonLibraryValue& Data, const FWebInterfaceCallback& Callback, const FWebInterfaceEventPolicy* Policy );
+	void DispatchEvent( FName Name, const FJsonLibraryValue& Data, const FWebInterfaceCallback& Callback );
+	void DispatchPendingEvents();
+	void RemovePendingEvent( int32 Index );
+	void IndexPendingEvents();
+
+	TSharedPtr<class FWebInterfaceHashDecoder, ESPMode::ThreadSafe> HashDecoder;
+	FDelegateHandle HashHandle;
+
+	void DispatchDecodedEvents();
+
+	TArray<FWebInterfaceQueuedCall> QueuedCalls;
+	TMap<FString, int32> CoalescedCalls;
+	FDelegateHandle FlushHandle;
+
+	void Enqueue( const FString& Function, const FJsonLibraryValue& Data, bool bScript, bool bCoalesce );
+	void SendCall( const FString& Function, const FJsonLibraryValue& Data );
+	void SendTypedArray( const FString& Function, struct FWebInterfaceJSParam& Data );
+
+	TArray<FWebInterfaceBulkCall> BulkCalls;
+	FDelegateHandle BulkHandle;
+	int32 NextBulkId;
+
+	int32 GetBulkBudget() const;
+	void EnqueueBulk( const FString& Function, const FJsonLibraryValue& Data, bool bCoalesce );
+	void SendBulk();
+
+	// pooled callbacks resolved this frame, sent to ue.interface.$resolve together
+	TArray<FJsonLibraryValue> PendingResolves;
+	FDelegateHandle ResolveHandle;
+
+	void Resolve( const FString& Callback, const FJsonLibraryValue& Data );
+	void InstallResolver();
+	void FlushResolves();
+
+	TArray<FWebInterfaceScript> Scripts;
+
+	void InstallScripts( int32 First = 0, int32 Last = INDEX_NONE );
+
+	UPROPERTY()
+	TMap<FString, UWebInterfaceStateStore*> StateStores;
+	bool bStateInstalled;
+
+	void InstallState();
+	void ReceiveState( const FJsonLibraryValue& Data );
+
+	void HandleLoadCompleted();
 	void HandleUrlChanged( const FText& URL );
 	bool HandleBeforePopup( FString URL, FString Frame );
 	void HandleConsole( const FString& Text, FColor Color );
@@ -157,6 +366,15 @@ protected:
 	FString InitialURL;
 	UPROPERTY(EditAnywhere, Category = "Behavior", AdvancedDisplay)
 	bool bAcceleratedPaint;
+	UPROPERTY(EditAnywhere, Category = "Behavior", AdvancedDisplay)
+	bool bBatchCalls;
+	UPROPERTY(EditAnywhere, Category = "Behavior", AdvancedDisplay, meta = (ClampMin = 0, Units = "KB"))
+	int32 BulkBudget;
+	
+	UPROPERTY(EditAnywhere, Category = "Behavior|Events", meta = (ClampMin = 0, Units = "ms"))
+	float EventBudget;
+	UPROPERTY(EditAnywhere, Category = "Behavior|Events")
+	TMap<FName, FWebInterfaceEventPolicy> EventPolicies;
 
 	UPROPERTY(EditAnywhere, meta = (DisplayName = "Enable Transparency"), Category = "Behavior|Mouse")
 	bool bEnableMouseTransparency;
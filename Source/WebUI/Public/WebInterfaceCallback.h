@@ -5,6 +5,9 @@
 
 class UWebInterface;
 
+// A callback passed with a broadcast, called by name on ue.interface.
+// Callbacks made with ue.interface.$callback(fn) are pooled, their results are sent to the page once per frame.
+// They are only called once, calling them again or after the page has reloaded does nothing.
 USTRUCT(BlueprintType)
 struct WEBUI_API FWebInterfaceCallback
 {
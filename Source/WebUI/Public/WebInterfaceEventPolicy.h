@@ -0,0 +1,26 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "CoreMinimal.h"
+#include "WebInterfaceEventPolicy.generated.h"
+
+// Limits how often an event broadcast from the browser is dispatched.
+USTRUCT(BlueprintType)
+struct WEBUI_API FWebInterfaceEventPolicy
+{
+	GENERATED_USTRUCT_BODY()
+
+	FWebInterfaceEventPolicy();
+
+	// Maximum number of dispatches per second, or zero for no limit.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event Policy", meta = (ClampMin = 0))
+	float MaxRate;
+	// Only dispatch the latest data when a broadcast is still waiting.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event Policy")
+	bool bCoalesce;
+	// Maximum number of waiting broadcasts, the oldest are dropped. Zero for the default of 64.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event Policy", meta = (ClampMin = 0))
+	int32 MaxQueued;
+
+	// Check if the policy limits anything.
+	bool IsActive() const;
+};
@@ -16,6 +16,9 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category = "Web UI")
 	void Broadcast( const FString& Name, const FString& Data, const FString& Callback );
+	// Called with ue.interface.broadcastdata(name, data, callback), data is received as native values instead of JSON text.
+	UFUNCTION(BlueprintCallable, Category = "Web UI")
+	void BroadcastData( const FString& Name, const FJsonLibraryValue& Data, const FString& Callback );
 
 private:
 
@@ -1,5 +1,6 @@
 // Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
 #pragma once
+#include "WebInterfaceEventPolicy.h"
 #include "WebInterfaceSettings.generated.h"
 
 UCLASS(config=Game, defaultconfig)
@@ -13,11 +14,29 @@ public:
 	{
 		bCopySubresourceRegion = false;
 		bForceDisableAcceleratedPaint = false;
+		EventBudget = 0.0f;
+		BulkBudget = 256;
 	}
 
 	UPROPERTY(config, EditAnywhere, Category="Performance", meta=(DisplayName="Subresource Region Copying"))
 	bool bCopySubresourceRegion;
 
+	// Kilobytes of UTF-8 text per frame each interface may send for bulk calls, the rest waits for the next frame.
+	UPROPERTY(config, EditAnywhere, Category="Performance", meta=(ClampMin=1, Units="KB"))
+	int32 BulkBudget;
+
+	// Milliseconds per frame each interface may spend dispatching events from the browser, zero for no limit.
+	UPROPERTY(config, EditAnywhere, Category="Events", meta=(ClampMin=0, Units="ms"))
+	float EventBudget;
+
+	// Policy for events that don't have their own.
+	UPROPERTY(config, EditAnywhere, Category="Events")
+	FWebInterfaceEventPolicy DefaultEventPolicy;
+
+	// Policies by event name, these can be overridden per interface.
+	UPROPERTY(config, EditAnywhere, Category="Events")
+	TMap<FName, FWebInterfaceEventPolicy> EventPolicies;
+
 	UPROPERTY(config, EditAnywhere, Category="Licensed Project (tracerinteractive.com)", meta=(EditCondition="!bForceDisableAcceleratedPaint"))
 	FString LicenseKey;
 
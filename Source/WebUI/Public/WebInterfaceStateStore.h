@@ -0,0 +1,93 @@
+// Copyright 2024 Tracer Interactive, LLC. All Rights Reserved.
+#pragma once
+#include "JsonLibrary.h"
+#include "WebInterfaceStateStore.generated.h"
+
+class UWebInterface;
+
+UENUM(BlueprintType, meta = (DisplayName = "UI State Sync"))
+enum class EWebInterfaceStateSync : uint8
+{
+	OneWay	UMETA(DisplayName="One Way"),
+	TwoWay	UMETA(DisplayName="Two Way")
+};
+
+UENUM(BlueprintType, meta = (DisplayName = "UI State Conflict"))
+enum class EWebInterfaceStateConflict : uint8
+{
+	EngineWins	UMETA(DisplayName="Engine Wins"),
+	PageWins	UMETA(DisplayName="Page Wins")
+};
+
+// A JSON object mirrored to ue.state[name] in the browser context.
+// Changes are sent as merge patches once per frame, and the page is told which paths changed.
+UCLASS(BlueprintType)
+class WEBUI_API UWebInterfaceStateStore : public UObject
+{
+	friend class UWebInterface;
+
+	GENERATED_BODY()
+
+public:
+
+	UWebInterfaceStateStore();
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams( FOnStateChanged, const FString&, Key, FJsonLibraryValue, Value, bool, bFromPage );
+
+	// Get the state, changes made to it are sent to the page.
+	UFUNCTION(BlueprintPure, Category = "Web UI|State")
+	FJsonLibraryObject GetState() const;
+	// Get the name of the state on the page.
+	UFUNCTION(BlueprintPure, Category = "Web UI|State")
+	FString GetName() const;
+
+	// Send changes made inside nested objects, only properties set on the state itself are tracked.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|State")
+	void MarkDirty();
+	// Send changes now instead of at the end of the frame.
+	UFUNCTION(BlueprintCallable, Category = "Web UI|State")
+	void Flush();
+
+	// Called when a property of the state is added, changed or removed.
+	UPROPERTY(BlueprintAssignable, Category = "Web UI|State")
+	FOnStateChanged OnStateChanged;
+
+	// Allow the page to change the state with ue.state.$patch(name, patch).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Web UI|State")
+	EWebInterfaceStateSync Sync;
+	// Which side is kept when both change a property before seeing the other's change.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Web UI|State")
+	EWebInterfaceStateConflict Conflict;
+
+	// Get the script that installs ue.state on the page.
+	static FString GetScript();
+
+private:
+
+	FString MyName;
+	TWeakObjectPtr<UWebInterface> MyInterface;
+
+	FJsonLibraryObject State;
+	// what the page has been sent
+	FJsonLibraryObject Mirror;
+
+	// properties to send at the next flush, changed here or changed back on the page
+	TSet<FString> DirtyKeys;
+	TMap<FString, int32> KeyVersions;
+	int32 Version;
+
+	bool bDirty;
+	bool bAllDirty;
+	bool bSynced;
+	bool bReceiving;
+
+	FDelegateHandle FlushHandle;
+
+	void Initialize( UWebInterface* Interface, const FString& Name );
+	void ResetPage();
+	void ScheduleFlush();
+	void ReceivePatch( const FJsonLibraryObject& Patch, int32 BaseVersion );
+
+	UFUNCTION()
+	void HandleNotify( const FJsonLibraryValue& Object, EJsonLibraryNotifyAction Action, const FString& Key, const FJsonLibraryValue& Value );
+};